@@ -13,6 +13,7 @@
 #ifndef GRAPH_ADJACENCY_LIST_HPP
 #define GRAPH_ADJACENCY_LIST_HPP
 
+#include "graph_range.hpp"
 #include "tags.hpp"
 #include "traits.hpp"
 #include "properties.hpp"
@@ -23,6 +24,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <list>
 #include <type_traits>
 #include <vector>
@@ -31,22 +33,33 @@
 
 namespace graph {
 
+// InlineEdgePropT is an optional small property, e.g. a weight, stored in the
+// adjacency entries and in the edge descriptors themselves, besides EdgePropT
+// which is stored in the edge list. Traversals of out- or in-edges can then
+// read it without accessing the edge list. It is read with inlineProp(e, g)
+// and changed with setInlineProp(e, ip, g).
 template<typename DirectedCategoryT,
          typename VertexPropT = NoProp,
-         typename EdgePropT = NoProp>
-requires std::derived_from<DirectedCategoryT, tags::Undirected> ||
-         std::derived_from<DirectedCategoryT, tags::Directed>
+         typename EdgePropT = NoProp,
+         typename InlineEdgePropT = NoProp>
+requires (std::derived_from<DirectedCategoryT, tags::Undirected> ||
+          std::derived_from<DirectedCategoryT, tags::Directed>) &&
+         std::is_trivially_copyable_v<InlineEdgePropT>
 struct AdjacencyList
 {
 private:
 	struct OutEdge
     {
         std::size_t tar;
+        std::size_t storedEdgeIdx;
+        [[no_unique_address]] InlineEdgePropT inlineProp;
 	};
 
     struct InEdge
     {
         std::size_t src;
+        std::size_t storedEdgeIdx;
+        [[no_unique_address]] InlineEdgePropT inlineProp;
     };
 
 	using OutEdgeList = std::vector<OutEdge>;
@@ -109,6 +122,7 @@ private:
 
 		std::size_t src, tar;
         EdgePropT1 prop;
+        [[no_unique_address]] InlineEdgePropT inlineProp{};
 	};
 
     // partial specialization
@@ -117,7 +131,10 @@ private:
     {
         StoredEdgeSimple(std::size_t src, std::size_t tar) : src(src), tar(tar) { }
 
+        StoredEdgeSimple(std::size_t src, std::size_t tar, NoProp &&) : src(src), tar(tar) { }
+
         std::size_t src, tar;
+        [[no_unique_address]] InlineEdgePropT inlineProp{};
     };
 
     using StoredEdge = StoredEdgeSimple<EdgePropT>;
@@ -133,12 +150,15 @@ public: // Graph
     {
 		EdgeDescriptor() = default;
 		EdgeDescriptor(std::size_t src, std::size_t tar,
-		               std::size_t storedEdgeIdx)
-			: src(src), tar(tar), storedEdgeIdx(storedEdgeIdx) {}
+		               std::size_t storedEdgeIdx,
+		               InlineEdgePropT inlineProp = InlineEdgePropT{})
+			: src(src), tar(tar), storedEdgeIdx(storedEdgeIdx),
+			  inlineProp(inlineProp) {}
 
 	public:
 		std::size_t src, tar;
 		std::size_t storedEdgeIdx;
+		[[no_unique_address]] InlineEdgePropT inlineProp{};
 
 	public:
 		friend bool operator==(const EdgeDescriptor &a,
@@ -151,25 +171,47 @@ public: // Graph
 public: // PropertyGraph
 	using VertexProp = VertexPropT;
 	using EdgeProp = EdgePropT;
+	using InlineEdgeProp = InlineEdgePropT;
 
 public: // VertexListGraph
-	struct VertexRange
+	struct VertexRange : detail::GraphRange<VertexRange>
     {
 		// the iterator is simply a counter that returns its value when
 		// dereferenced
-		using iterator = boost::counting_iterator<VertexDescriptor>;
+		struct iterator : boost::iterator_adaptor<
+				iterator, boost::counting_iterator<VertexDescriptor>, VertexDescriptor,
+				std::random_access_iterator_tag, VertexDescriptor>
+		{
+			using Base = boost::iterator_adaptor<
+				iterator, boost::counting_iterator<VertexDescriptor>, VertexDescriptor,
+				std::random_access_iterator_tag, VertexDescriptor>;
+			// Boost reports returning by value as an input iterator, and gives
+			// a proxy from operator[], so state what the iterator really is.
+			using iterator_concept = std::random_access_iterator_tag;
+
+		public:
+			iterator() = default;
+			explicit iterator(VertexDescriptor v) : Base(boost::counting_iterator<VertexDescriptor>(v)) {}
+
+			VertexDescriptor operator[](typename Base::difference_type k) const
+			{
+				return *(*this + k);
+			}
+		};
 
 	public:
+		VertexRange() = default;
 		VertexRange(std::size_t n) : n(n) {}
 		iterator begin() const { return iterator(0); }
 		iterator end()   const { return iterator(n); }
+		std::size_t size() const { return n; }
 
 	private:
-		std::size_t n;
+		std::size_t n = 0;
 	};
 
 public: // EdgeListGraph
-	struct EdgeRange
+	struct EdgeRange : detail::GraphRange<EdgeRange>
     {
 		// We want to adapt the edge list,
 		// so it dereferences to EdgeDescriptor instead of StoredEdge
@@ -188,10 +230,16 @@ public: // EdgeListGraph
 			using Base = boost::iterator_adaptor<
 				iterator, EListIterator, EdgeDescriptor,
 				std::random_access_iterator_tag, EdgeDescriptor>;
+			using iterator_concept = std::random_access_iterator_tag;
 		public:
 			iterator() = default;
 			iterator(EListIterator i, EListIterator first) : Base(i), first(first) {}
 
+			EdgeDescriptor operator[](typename Base::difference_type k) const
+			{
+				return *(*this + k);
+			}
+
 		private:
 			// let the Boost machinery use our methods:
 			friend class boost::iterator_core_access;
@@ -202,7 +250,7 @@ public: // EdgeListGraph
 				// boost::iterator_adaptor base class
 				const EListIterator &i = this->base_reference();
 				return EdgeDescriptor{i->src, i->tar,
-					static_cast<std::size_t>(i - first)};
+					static_cast<std::size_t>(i - first), i->inlineProp};
 			}
 
 		private:
@@ -210,6 +258,7 @@ public: // EdgeListGraph
 		};
 
 	public:
+		EdgeRange() = default;
 		EdgeRange(const AdjacencyList &g) : g(&g) {}
 
 		iterator begin() const
@@ -222,12 +271,17 @@ public: // EdgeListGraph
 			return iterator(g->eList.end(), g->eList.begin());
 		}
 
+		std::size_t size() const
+		{
+			return g->eList.size();
+		}
+
 	private:
-		const AdjacencyList *g;
+		const AdjacencyList *g = nullptr;
 	};
 
 public: // IncidenceGraph
-    struct OutEdgeRange
+    struct OutEdgeRange : detail::GraphRange<OutEdgeRange>
     {
         // We want to adapt the edge list,
         // so it dereferences to EdgeDescriptor instead of StoredEdge
@@ -246,10 +300,16 @@ public: // IncidenceGraph
             using Base = boost::iterator_adaptor<
                     iterator, OutEdgeListIterator, EdgeDescriptor,
                     std::random_access_iterator_tag, EdgeDescriptor>;
+            using iterator_concept = std::random_access_iterator_tag;
         public:
             iterator() = default;
-            iterator(OutEdgeListIterator i, OutEdgeListIterator first, VertexDescriptor src)
-                : Base(i), first(first), src(src) { }
+            iterator(OutEdgeListIterator i, VertexDescriptor src)
+                : Base(i), src(src) { }
+
+            EdgeDescriptor operator[](typename Base::difference_type k) const
+            {
+                return *(*this + k);
+            }
 
         private:
             // let the Boost machinery use our methods:
@@ -260,35 +320,39 @@ public: // IncidenceGraph
                 // get our current position stored in the
                 // boost::iterator_adaptor base class
                 const OutEdgeListIterator &i = this->base_reference();
-                return EdgeDescriptor{src, i->tar,
-                                      static_cast<std::size_t>(i - first)};
+                return EdgeDescriptor{src, i->tar, i->storedEdgeIdx, i->inlineProp};
             }
 
         private:
-            OutEdgeListIterator first;
-            std::size_t src;
+            std::size_t src = 0;
         };
 
     public:
+        OutEdgeRange() = default;
         OutEdgeRange(VertexDescriptor v, const AdjacencyList &g) : src(v), g(&g) { }
 
         iterator begin() const
         {
-            return iterator(g->vList[src].eOut.begin(), g->vList[src].eOut.begin(), src);
+            return iterator(g->vList[src].eOut.begin(), src);
         }
 
         iterator end() const
         {
-            return iterator(g->vList[src].eOut.end(), g->vList[src].eOut.begin(), src);
+            return iterator(g->vList[src].eOut.end(), src);
+        }
+
+        std::size_t size() const
+        {
+            return g->vList[src].eOut.size();
         }
 
     private:
-        std::size_t src;
-        const AdjacencyList *g;
+        std::size_t src = 0;
+        const AdjacencyList *g = nullptr;
     };
 
 public: // BidirectionalGraph
-    struct InEdgeRange
+    struct InEdgeRange : detail::GraphRange<InEdgeRange>
     {
         // We want to adapt the edge list,
         // so it dereferences to EdgeDescriptor instead of StoredEdge
@@ -307,10 +371,16 @@ public: // BidirectionalGraph
             using Base = boost::iterator_adaptor<
                     iterator, InEdgeListIterator, EdgeDescriptor,
                     std::random_access_iterator_tag, EdgeDescriptor>;
+            using iterator_concept = std::random_access_iterator_tag;
         public:
             iterator() = default;
-            iterator(InEdgeListIterator i, InEdgeListIterator first, VertexDescriptor tar)
-                : Base(i), first(first), tar(tar) { }
+            iterator(InEdgeListIterator i, VertexDescriptor tar)
+                : Base(i), tar(tar) { }
+
+            EdgeDescriptor operator[](typename Base::difference_type k) const
+            {
+                return *(*this + k);
+            }
 
         private:
             // let the Boost machinery use our methods:
@@ -321,31 +391,35 @@ public: // BidirectionalGraph
                 // get our current position stored in the
                 // boost::iterator_adaptor base class
                 const InEdgeListIterator &i = this->base_reference();
-                return EdgeDescriptor{i->src, tar,
-                                      static_cast<std::size_t>(i - first)};
+                return EdgeDescriptor{i->src, tar, i->storedEdgeIdx, i->inlineProp};
             }
 
         private:
-            InEdgeListIterator first;
-            std::size_t tar;
+            std::size_t tar = 0;
         };
 
     public:
+        InEdgeRange() = default;
         InEdgeRange(VertexDescriptor v, const AdjacencyList &g) : tar(v), g(&g) { }
 
         iterator begin() const
         {
-            return iterator(g->vList[tar].eIn.begin(), g->vList[tar].eIn.begin(), tar);
+            return iterator(g->vList[tar].eIn.begin(), tar);
         }
 
         iterator end() const
         {
-            return iterator(g->vList[tar].eIn.end(), g->vList[tar].eIn.begin(), tar);
+            return iterator(g->vList[tar].eIn.end(), tar);
+        }
+
+        std::size_t size() const
+        {
+            return g->vList[tar].eIn.size();
         }
 
     private:
-        std::size_t tar;
-        const AdjacencyList *g;
+        std::size_t tar = 0;
+        const AdjacencyList *g = nullptr;
     };
 
 public:
@@ -429,21 +503,23 @@ public: // MutableGraph
 
 private:
     friend EdgeDescriptor addEdgeImpl(VertexDescriptor u, VertexDescriptor v,
-                                      AdjacencyList &g, tags::Directed)
+                                      InlineEdgeProp ip, AdjacencyList &g, tags::Directed)
     {
-        g.vList[u].eOut.push_back(OutEdge{v});
+        g.vList[u].eOut.push_back(OutEdge{v, g.eList.size(), ip});
         g.eList.push_back(StoredEdge{u, v});
-        return EdgeDescriptor{u, v, g.eList.size() - 1};
+        g.eList.back().inlineProp = ip;
+        return EdgeDescriptor{u, v, g.eList.size() - 1, ip};
     }
 
 private:
     friend EdgeDescriptor addEdgeImpl(VertexDescriptor u, VertexDescriptor v,
-                                      AdjacencyList &g, tags::Bidirectional)
+                                      InlineEdgeProp ip, AdjacencyList &g, tags::Bidirectional)
     {
-        g.vList[u].eOut.push_back(OutEdge{v});
-        g.vList[v].eIn.push_back(InEdge{u});
+        g.vList[u].eOut.push_back(OutEdge{v, g.eList.size(), ip});
+        g.vList[v].eIn.push_back(InEdge{u, g.eList.size(), ip});
         g.eList.push_back(StoredEdge{u, v});
-        return EdgeDescriptor{u, v, g.eList.size() - 1};
+        g.eList.back().inlineProp = ip;
+        return EdgeDescriptor{u, v, g.eList.size() - 1, ip};
     }
 
 public:
@@ -456,7 +532,23 @@ public:
                                   AdjacencyList &g)
     requires std::default_initializable<EdgeProp>
     {
-        return addEdgeImpl(u, v, g, DirectedCategory{});
+        return addEdgeImpl(u, v, InlineEdgeProp{}, g, DirectedCategory{});
+    }
+
+public:
+    // Adds an edge to g between vertices u (src) and v (tar), with inline
+    // property ip, to a graph whose only edge property is the inline one,
+    // e.g. AdjacencyList<tags::Directed, NoProp, NoProp, float> for a graph
+    // with a weight on each edge.
+    // The following pre-conditions are required:
+    // - Both u and v are valid vertex descriptors for g
+    // - u and v are different
+    // - No edge (u, v) exist already in g
+    friend EdgeDescriptor addEdge(VertexDescriptor u, VertexDescriptor v,
+                                  InlineEdgeProp ip, AdjacencyList &g)
+    requires std::same_as<EdgeProp, NoProp> && (!std::same_as<InlineEdgeProp, NoProp>)
+    {
+        return addEdgeImpl(u, v, ip, g, DirectedCategory{});
     }
 
 public: // MutablePropertyGraph
@@ -469,21 +561,25 @@ public: // MutablePropertyGraph
 
 private:
     friend EdgeDescriptor addEdgeImpl(VertexDescriptor u, VertexDescriptor v,
-                                      EdgeProp &&ep, AdjacencyList &g, tags::Directed)
+                                      EdgeProp &&ep, InlineEdgeProp ip,
+                                      AdjacencyList &g, tags::Directed)
     {
-        g.vList[u].eOut.push_back(OutEdge{v});
+        g.vList[u].eOut.push_back(OutEdge{v, g.eList.size(), ip});
         g.eList.push_back(StoredEdge{u, v, std::move(ep)});
-        return EdgeDescriptor{u, v, g.eList.size() - 1};
+        g.eList.back().inlineProp = ip;
+        return EdgeDescriptor{u, v, g.eList.size() - 1, ip};
     }
 
 private:
     friend EdgeDescriptor addEdgeImpl(VertexDescriptor u, VertexDescriptor v,
-                                      EdgeProp &&ep, AdjacencyList &g, tags::Bidirectional)
+                                      EdgeProp &&ep, InlineEdgeProp ip,
+                                      AdjacencyList &g, tags::Bidirectional)
     {
-        g.vList[u].eOut.push_back(OutEdge{v});
-        g.vList[v].eIn.push_back(InEdge{u});
+        g.vList[u].eOut.push_back(OutEdge{v, g.eList.size(), ip});
+        g.vList[v].eIn.push_back(InEdge{u, g.eList.size(), ip});
         g.eList.push_back(StoredEdge{u, v, std::move(ep)});
-        return EdgeDescriptor{u, v, g.eList.size() - 1};
+        g.eList.back().inlineProp = ip;
+        return EdgeDescriptor{u, v, g.eList.size() - 1, ip};
     }
 
 public:
@@ -496,7 +592,51 @@ public:
                                   EdgeProp &&ep, AdjacencyList &g)
     requires std::movable<EdgeProp>
     {
-        return addEdgeImpl(u, v, std::move(ep), g, DirectedCategory{});
+        return addEdgeImpl(u, v, std::move(ep), InlineEdgeProp{}, g, DirectedCategory{});
+    }
+
+public:
+    // Adds an edge to g between vertices u (src) and v (tar), with property ep
+    // and inline property ip.
+    // The following pre-conditions are required:
+    // - Both u and v are valid vertex descriptors for g
+    // - u and v are different
+    // - No edge (u, v) exist already in g
+    friend EdgeDescriptor addEdge(VertexDescriptor u, VertexDescriptor v,
+                                  EdgeProp &&ep, InlineEdgeProp ip, AdjacencyList &g)
+    requires std::movable<EdgeProp> && (!std::same_as<InlineEdgeProp, NoProp>)
+    {
+        return addEdgeImpl(u, v, std::move(ep), ip, g, DirectedCategory{});
+    }
+
+public: // Inline edge properties
+    // Returns the inline property of e, which is carried by the descriptor.
+    friend InlineEdgeProp inlineProp(EdgeDescriptor e, const AdjacencyList &g)
+    requires (!std::same_as<InlineEdgeProp, NoProp>)
+    {
+        return e.inlineProp;
+    }
+
+    // Changes the inline property of e in all the places it is stored.
+    // Descriptors obtained before the change still carry the old value.
+    // The following pre-conditions are required:
+    // - e is a valid edge descriptor for g
+    friend void setInlineProp(EdgeDescriptor e, InlineEdgeProp ip, AdjacencyList &g)
+    requires (!std::same_as<InlineEdgeProp, NoProp>)
+    {
+        g.eList[e.storedEdgeIdx].inlineProp = ip;
+        for (auto &oe : g.vList[e.src].eOut) {
+            if (oe.storedEdgeIdx == e.storedEdgeIdx) {
+                oe.inlineProp = ip;
+            }
+        }
+        if constexpr (std::same_as<DirectedCategory, tags::Bidirectional>) {
+            for (auto &ie : g.vList[e.tar].eIn) {
+                if (ie.storedEdgeIdx == e.storedEdgeIdx) {
+                    ie.inlineProp = ip;
+                }
+            }
+        }
     }
 
 public: // PropertyGraph
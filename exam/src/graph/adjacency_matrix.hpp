@@ -14,6 +14,7 @@
 #ifndef GRAPH_ADJACENCY_MATRIX_HPP
 #define GRAPH_ADJACENCY_MATRIX_HPP
 
+#include "graph_range.hpp"
 #include "tags.hpp"
 #include "traits.hpp"
 #include "properties.hpp"
@@ -23,6 +24,7 @@
 #include <boost/iterator/iterator_adaptor.hpp>
 
 #include <cassert>
+#include <iterator>
 #include <tuple>
 #include <vector>
 
@@ -50,18 +52,36 @@ public: // Graph
 
 	using DirectedCategory = tags::Directed;
 public: // VertexList
-	struct VertexRange {
+	struct VertexRange : detail::GraphRange<VertexRange> {
 		// the iterator is simply a counter that returns its value when dereferenced
-		using iterator = boost::counting_iterator<VertexDescriptor>;
+		struct iterator : boost::iterator_adaptor<
+				iterator, boost::counting_iterator<VertexDescriptor>, VertexDescriptor,
+				std::random_access_iterator_tag, VertexDescriptor> {
+			using Base = boost::iterator_adaptor<
+				iterator, boost::counting_iterator<VertexDescriptor>, VertexDescriptor,
+				std::random_access_iterator_tag, VertexDescriptor>;
+			// Boost reports returning by value as an input iterator, and gives
+			// a proxy from operator[], so state what the iterator really is.
+			using iterator_concept = std::random_access_iterator_tag;
+		public:
+			iterator() = default;
+			explicit iterator(VertexDescriptor v) : Base(boost::counting_iterator<VertexDescriptor>(v)) {}
+
+			VertexDescriptor operator[](typename Base::difference_type k) const {
+				return *(*this + k);
+			}
+		};
 	public:
+		VertexRange() = default;
 		VertexRange(std::size_t n) : n(n) {}
 		iterator begin() const { return iterator(0); }
 		iterator end()   const { return iterator(n); }
+		std::size_t size() const { return n; }
 	private:
-		std::size_t n;
+		std::size_t n = 0;
 	};
 public: // EdgeList
-	struct EdgeRange {
+	struct EdgeRange : detail::GraphRange<EdgeRange> {
 		// In the iterator, we want first adapt the MatrixIterator
 		// (which iterates through StoredEdges) to give EdgeDescirptors,
 		// and then skip those that don't exist in the graph.
@@ -80,6 +100,7 @@ public: // EdgeList
 				MatrixAdaptorIterator, MatrixIterator, EdgeDescriptor,
 				std::random_access_iterator_tag, EdgeDescriptor>;
 		public:
+			MatrixAdaptorIterator() = default;
 			MatrixAdaptorIterator(const MatrixIterator &i,
 			                      const MatrixIterator &first,
 			                      std::size_t n)
@@ -100,7 +121,7 @@ public: // EdgeList
 			}
 		public:
 			MatrixIterator first;
-			std::size_t n;
+			std::size_t n = 0;
 		};
 
 		// Now wrap the matrix iterator such that entries
@@ -112,6 +133,7 @@ public: // EdgeList
 		};
 		using iterator = boost::filter_iterator<EdgeExistPred, MatrixAdaptorIterator>;
 	public:
+		EdgeRange() = default;
 		EdgeRange(const AdjacencyMatrix *g) : g(g) { }
 
 		iterator begin() const {
@@ -127,11 +149,17 @@ public: // EdgeList
 				MatrixAdaptorIterator(g->matrix.end(), g->matrix.begin(), g->n)
 			);
 		}
+
+		// the iterator skips the missing edges, so it is only forward, but the
+		// number of edges is known
+		std::size_t size() const {
+			return g->m;
+		}
 	private:
-		const AdjacencyMatrix *g;
+		const AdjacencyMatrix *g = nullptr;
 	};
 public: // Incidence
-	struct OutEdgeRange {
+	struct OutEdgeRange : detail::GraphRange<OutEdgeRange> {
 		// we can reuse the EdgeRange::iterator
 		// as the out-edges are simply a sub-range of the edges.
 		// For example, in the following adj. matrix (. means no edge, e means edge)
@@ -144,6 +172,7 @@ public: // Incidence
 		// ...
 		using iterator = typename EdgeRange::iterator;
 	public:
+		OutEdgeRange() = default;
 		OutEdgeRange(VertexDescriptor v, const AdjacencyMatrix &g) : src(v), g(&g) { }
 
 		iterator begin() const {
@@ -169,8 +198,8 @@ public: // Incidence
 			);
 		}
 	private:
-		std::size_t src;
-		const AdjacencyMatrix *g;
+		std::size_t src = 0;
+		const AdjacencyMatrix *g = nullptr;
 	};	
 public:
 	AdjacencyMatrix(std::size_t n) : n(n), matrix(n * n) {}
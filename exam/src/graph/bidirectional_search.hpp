@@ -0,0 +1,286 @@
+/**
+ * bidirectional_search.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Point-to-point shortest paths searching from both ends at once.
+ */
+#ifndef GRAPH_BIDIRECTIONAL_SEARCH_HPP
+#define GRAPH_BIDIRECTIONAL_SEARCH_HPP
+
+#include "concepts.hpp"
+#include "d_ary_heap.hpp"
+#include "dijkstra.hpp"
+#include "property_map.hpp"
+#include "traits.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace graph {
+namespace detail {
+
+// The state of one direction of a bidirectional search. The entries are
+// stamped with the search that set them, so a search only pays for the
+// vertices it reaches.
+template<typename Graph, typename Distance>
+struct SearchSide
+{
+    using VertexDescriptor = typename Traits<Graph>::VertexDescriptor;
+
+    std::vector<unsigned> stamp;
+    std::vector<Distance> dist;
+    std::vector<VertexDescriptor> parent;
+    std::vector<VertexDescriptor> frontier, next;
+    IndexedDAryHeap<VertexDescriptor, Distance> heap;
+    unsigned epoch = 0;
+
+    void reset(std::size_t n)
+    {
+        if (stamp.size() < n) {
+            stamp.resize(n, 0);
+            dist.resize(n);
+            parent.resize(n);
+            heap.reserve(n);
+        }
+        if (++epoch == 0) {
+            std::fill(stamp.begin(), stamp.end(), 0);
+            epoch = 1;
+        }
+        frontier.clear();
+        next.clear();
+        heap.clear();
+    }
+
+    bool reached(std::size_t i) const
+    {
+        return stamp[i] == epoch;
+    }
+
+    void reach(std::size_t i, Distance d, VertexDescriptor p)
+    {
+        stamp[i] = epoch;
+        dist[i] = d;
+        parent[i] = p;
+    }
+};
+
+// The path from s through meet to t, following the parents of the forward
+// side back to s and those of the backward side on to t.
+template<typename Graph, typename Distance>
+std::vector<typename Traits<Graph>::VertexDescriptor>
+joinPath(const Graph &g, const SearchSide<Graph, Distance> &forward,
+         const SearchSide<Graph, Distance> &backward,
+         typename Traits<Graph>::VertexDescriptor s, typename Traits<Graph>::VertexDescriptor t,
+         typename Traits<Graph>::VertexDescriptor meet)
+{
+    auto path{std::vector<typename Traits<Graph>::VertexDescriptor>{meet}};
+    for (auto v = meet; getIndex(v, g) != getIndex(s, g);) {
+        v = forward.parent[getIndex(v, g)];
+        path.push_back(v);
+    }
+    std::reverse(path.begin(), path.end());
+    for (auto v = meet; getIndex(v, g) != getIndex(t, g);) {
+        v = backward.parent[getIndex(v, g)];
+        path.push_back(v);
+    }
+    return path;
+}
+
+} // namespace detail
+
+// The state of bidirectional searches, kept between calls so that repeated
+// queries on the same graph neither allocate nor touch all vertices.
+template<typename Graph, typename Distance = std::size_t>
+struct BidirectionalSearchWorkspace
+{
+    detail::SearchSide<Graph, Distance> forward, backward;
+};
+
+// A path and its length, the sum of the weights of its edges.
+template<typename Graph, typename Distance>
+struct WeightedPath
+{
+    Distance length;
+    std::vector<typename Traits<Graph>::VertexDescriptor> vertices;
+};
+
+// Returns the vertices of a path from s to t with the fewest edges, or an
+// empty optional if t cannot be reached from s.
+// Breadth-first searches run forward from s along out-edges and backward
+// from t along in-edges, each step expanding a whole level of the side with
+// the smaller frontier, until the level in which the searches meet. On
+// graphs that branch out, this reaches far fewer vertices than a search
+// from s alone.
+// The following pre-conditions are required:
+// - s and t are valid vertex descriptors for g
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph>
+requires BidirectionalGraph<Graph> && VertexListGraph<Graph>
+std::optional<std::vector<typename Traits<Graph>::VertexDescriptor>>
+shortestPath(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+             typename Traits<Graph>::VertexDescriptor t,
+             BidirectionalSearchWorkspace<Graph> &workspace)
+{
+    using VertexDescriptor = typename Traits<Graph>::VertexDescriptor;
+
+    auto n{static_cast<std::size_t>(numVertices(g))};
+    auto &forward{workspace.forward};
+    auto &backward{workspace.backward};
+    forward.reset(n);
+    backward.reset(n);
+    if (getIndex(s, g) == getIndex(t, g)) {
+        return std::vector<VertexDescriptor>{s};
+    }
+    forward.reach(getIndex(s, g), 0, s);
+    forward.frontier.push_back(s);
+    backward.reach(getIndex(t, g), 0, t);
+    backward.frontier.push_back(t);
+
+    auto best{infiniteDistance<std::size_t>()};
+    auto meet{s};
+    while (best == infiniteDistance<std::size_t>()
+           && !forward.frontier.empty() && !backward.frontier.empty()) {
+        bool isForward{forward.frontier.size() <= backward.frontier.size()};
+        auto &side{isForward ? forward : backward};
+        const auto &other{isForward ? backward : forward};
+        side.next.clear();
+        for (const auto &u : side.frontier) {
+            auto du{side.dist[getIndex(u, g)]};
+            auto visit = [&](const VertexDescriptor &v) {
+                auto vi{getIndex(v, g)};
+                if (side.reached(vi)) {
+                    return;
+                }
+                side.reach(vi, du + 1, u);
+                side.next.push_back(v);
+                if (other.reached(vi) && du + 1 + other.dist[vi] < best) {
+                    best = du + 1 + other.dist[vi];
+                    meet = v;
+                }
+            };
+            if (isForward) {
+                for (const auto &e : outEdges(u, g)) {
+                    visit(target(e, g));
+                }
+            } else {
+                for (const auto &e : inEdges(u, g)) {
+                    visit(source(e, g));
+                }
+            }
+        }
+        std::swap(side.frontier, side.next);
+    }
+    if (best == infiniteDistance<std::size_t>()) {
+        return std::nullopt;
+    }
+    return detail::joinPath(g, forward, backward, s, t, meet);
+}
+
+template<typename Graph>
+requires BidirectionalGraph<Graph> && VertexListGraph<Graph>
+std::optional<std::vector<typename Traits<Graph>::VertexDescriptor>>
+shortestPath(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+             typename Traits<Graph>::VertexDescriptor t)
+{
+    auto workspace{BidirectionalSearchWorkspace<Graph>{}};
+    return shortestPath(g, s, t, workspace);
+}
+
+// Returns a shortest path from s to t, where the weight of an edge e is
+// get(weightMap, e), or an empty optional if t cannot be reached from s.
+// Dijkstra's algorithm runs forward from s along out-edges and backward from
+// t along in-edges, each step settling a vertex of the side with fewer
+// vertices in its heap. Every edge relaxed into a vertex reached from the
+// other side gives a path, and the search ends once the two smallest
+// tentative distances together are no shorter than the best path found.
+// The following pre-conditions are required:
+// - s and t are valid vertex descriptors for g
+// - all weights are non-negative
+// - weightMap gives the same weight for an edge reached through outEdges
+//   and through inEdges
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph, typename WeightMap>
+requires BidirectionalGraph<Graph> && VertexListGraph<Graph>
+         && ReadablePropertyMap<WeightMap, typename Traits<Graph>::EdgeDescriptor>
+std::optional<WeightedPath<Graph, typename WeightMap::Value>>
+shortestPath(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+             typename Traits<Graph>::VertexDescriptor t, WeightMap weightMap,
+             BidirectionalSearchWorkspace<Graph, typename WeightMap::Value> &workspace)
+{
+    using Distance = typename WeightMap::Value;
+
+    auto n{static_cast<std::size_t>(numVertices(g))};
+    auto &forward{workspace.forward};
+    auto &backward{workspace.backward};
+    forward.reset(n);
+    backward.reset(n);
+    if (getIndex(s, g) == getIndex(t, g)) {
+        return WeightedPath<Graph, Distance>{Distance{}, {s}};
+    }
+    forward.reach(getIndex(s, g), Distance{}, s);
+    forward.heap.push(getIndex(s, g), s, Distance{});
+    backward.reach(getIndex(t, g), Distance{}, t);
+    backward.heap.push(getIndex(t, g), t, Distance{});
+
+    auto best{infiniteDistance<Distance>()};
+    auto meet{s};
+    while (!forward.heap.empty() && !backward.heap.empty()
+           && forward.heap.top().priority + backward.heap.top().priority < best) {
+        bool isForward{forward.heap.size() <= backward.heap.size()};
+        auto &side{isForward ? forward : backward};
+        const auto &other{isForward ? backward : forward};
+        auto u{side.heap.top().value};
+        auto du{side.heap.top().priority};
+        side.heap.pop();
+        auto relax = [&](const auto &e, const auto &v) {
+            auto vi{getIndex(v, g)};
+            Distance dv = du + get(weightMap, e);
+            if (!side.reached(vi)) {
+                side.reach(vi, dv, u);
+                side.heap.push(vi, v, dv);
+            } else if (dv < side.dist[vi] && side.heap.contains(vi)) {
+                side.reach(vi, dv, u);
+                side.heap.decrease(vi, dv);
+            }
+            if (other.reached(vi) && side.dist[vi] + other.dist[vi] < best) {
+                best = side.dist[vi] + other.dist[vi];
+                meet = v;
+            }
+        };
+        if (isForward) {
+            for (const auto &e : outEdges(u, g)) {
+                relax(e, target(e, g));
+            }
+        } else {
+            for (const auto &e : inEdges(u, g)) {
+                relax(e, source(e, g));
+            }
+        }
+    }
+    if (best == infiniteDistance<Distance>()) {
+        return std::nullopt;
+    }
+    return WeightedPath<Graph, Distance>{best, detail::joinPath(g, forward, backward, s, t, meet)};
+}
+
+template<typename Graph, typename WeightMap>
+requires BidirectionalGraph<Graph> && VertexListGraph<Graph>
+         && ReadablePropertyMap<WeightMap, typename Traits<Graph>::EdgeDescriptor>
+std::optional<WeightedPath<Graph, typename WeightMap::Value>>
+shortestPath(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+             typename Traits<Graph>::VertexDescriptor t, WeightMap weightMap)
+{
+    auto workspace{BidirectionalSearchWorkspace<Graph, typename WeightMap::Value>{}};
+    return shortestPath(g, s, t, weightMap, workspace);
+}
+
+} // namespace graph
+
+#endif // GRAPH_BIDIRECTIONAL_SEARCH_HPP
@@ -0,0 +1,211 @@
+/**
+ * breadth_first_search.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Breadth-first search with a visitor, and level-synchronous parallel
+ * breadth-first search.
+ */
+#ifndef GRAPH_BREADTH_FIRST_SEARCH_HPP
+#define GRAPH_BREADTH_FIRST_SEARCH_HPP
+
+#include "concepts.hpp"
+#include "parallel.hpp"
+#include "traits.hpp"
+#include "vertex_index.hpp"
+#include "traversal_workspace.hpp"
+
+#include <atomic>
+#include <limits>
+#include <vector>
+
+namespace graph {
+
+struct BFSNullVisitor {
+	template<typename G, typename V>
+	void discoverVertex(const V& v, const G& g) { }
+
+	template<typename G, typename V>
+	void examineVertex(const V& v, const G& g) { }
+
+	template<typename G, typename V>
+	void finishVertex(const V& v, const G& g) { }
+
+	template<typename G, typename E>
+	void examineEdge(const E& e, const G& g) { }
+
+	template<typename G, typename E>
+	void treeEdge(const E& e, const G& g) { }
+
+	template<typename G, typename E>
+	void nonTreeEdge(const E& e, const G& g) { }
+
+	template<typename G, typename E>
+	void greyTarget(const E& e, const G& g) { }
+
+	template<typename G, typename E>
+	void blackTarget(const E& e, const G& g) { }
+};
+
+// Breadth-first search of the vertices reachable from s, calling the hooks of
+// visitor as it goes: a vertex is discovered when it is first seen, examined
+// when it leaves the queue, and finished after all its out-edges have been
+// examined. An edge to an undiscovered vertex is a tree edge, and any other
+// edge a non-tree edge, to a grey target still in the queue or to a black
+// target already finished.
+// The visitor is taken by value, but the same copy is used for the whole
+// search. The colours and the queue are kept in workspace, which is reset
+// first, so a search takes time in the number of vertices and edges it
+// reaches, independent of the size of g.
+// The following pre-conditions are required:
+// - s is a valid vertex descriptor for g
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph, typename Visitor>
+requires IncidenceGraph<Graph>
+void bfs(const Graph &g, typename Traits<Graph>::VertexDescriptor s, Visitor visitor,
+         TraversalWorkspace<Graph> &workspace)
+{
+    using Colour = detail::DFSColour;
+
+    workspace.reset(g);
+    auto &queue{workspace.queue()};
+    workspace.setColour(getIndex(s, g), Colour::Grey);
+    visitor.discoverVertex(s, g);
+    queue.push_back(s);
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        auto u{queue[head]};
+        visitor.examineVertex(u, g);
+        for (const auto &e : outEdges(u, g)) {
+            auto v{target(e, g)};
+            visitor.examineEdge(e, g);
+            auto colour{workspace.colour(getIndex(v, g))};
+            if (colour == Colour::White) {
+                visitor.treeEdge(e, g);
+                workspace.setColour(getIndex(v, g), Colour::Grey);
+                visitor.discoverVertex(v, g);
+                queue.push_back(v);
+            } else {
+                visitor.nonTreeEdge(e, g);
+                if (colour == Colour::Grey) {
+                    visitor.greyTarget(e, g);
+                } else {
+                    visitor.blackTarget(e, g);
+                }
+            }
+        }
+        workspace.setColour(getIndex(u, g), Colour::Black);
+        visitor.finishVertex(u, g);
+    }
+}
+
+template<typename Graph, typename Visitor>
+requires IncidenceGraph<Graph>
+void bfs(const Graph &g, typename Traits<Graph>::VertexDescriptor s, Visitor visitor)
+{
+    auto workspace{TraversalWorkspace<Graph>(g)};
+    bfs(g, s, visitor, workspace);
+}
+
+template<typename Graph>
+struct BFSResult
+{
+    using VertexDescriptor = typename Traits<Graph>::VertexDescriptor;
+
+    static constexpr std::size_t unreachable = std::numeric_limits<std::size_t>::max();
+
+    // distance[getIndex(v, g)] is the number of edges on a shortest path from
+    // the source to v, or unreachable.
+    std::vector<std::size_t> distance;
+    // parent[getIndex(v, g)] is the predecessor of v in the search tree.
+    // The source and the unreachable vertices are their own parent.
+    std::vector<VertexDescriptor> parent;
+};
+
+// Breadth-first search from s, where each level is expanded by all threads of
+// pool. Every thread collects the vertices it discovers in a local frontier,
+// and a vertex is claimed by a compare-and-swap on its parent, so each vertex
+// is discovered exactly once.
+// The following pre-conditions are required:
+// - s is a valid vertex descriptor for g
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+BFSResult<Graph> parallelBfs(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+                             ThreadPool &pool)
+{
+    constexpr auto none{std::numeric_limits<std::size_t>::max()};
+    constexpr std::size_t grain{256};
+
+    auto n{static_cast<std::size_t>(numVertices(g))};
+
+    auto vertexOf{detail::indexedVertices(g)};
+
+    auto result{BFSResult<Graph>{}};
+    result.distance.resize(n);
+    auto parent{std::vector<std::atomic<std::size_t>>(n)};
+    detail::parallelChunks(pool, n, 4096, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            result.distance[i] = BFSResult<Graph>::unreachable;
+            parent[i].store(none, std::memory_order_relaxed);
+        }
+    });
+
+    auto frontier{std::vector<std::size_t>{getIndex(s, g)}};
+    parent[frontier.front()].store(frontier.front(), std::memory_order_relaxed);
+    result.distance[frontier.front()] = 0;
+
+    auto next{std::vector<std::vector<std::size_t>>(pool.numThreads())};
+    for (std::size_t level = 1; !frontier.empty(); ++level) {
+        for (auto &local : next) {
+            local.clear();
+        }
+        detail::parallelChunks(pool, frontier.size(), grain,
+                               [&](std::size_t tid, std::size_t first, std::size_t last) {
+            auto &local{next[tid]};
+            for (auto i = first; i < last; ++i) {
+                auto u{frontier[i]};
+                for (const auto &e : outEdges(vertexOf[u], g)) {
+                    auto v{getIndex(target(e, g), g)};
+                    // cheap test first, so the CAS is only paid by candidates
+                    if (parent[v].load(std::memory_order_relaxed) != none) {
+                        continue;
+                    }
+                    auto expected{none};
+                    if (parent[v].compare_exchange_strong(expected, u, std::memory_order_relaxed)) {
+                        result.distance[v] = level;
+                        local.push_back(v);
+                    }
+                }
+            }
+        });
+        detail::parallelConcat(pool, next, frontier);
+    }
+
+    result.parent.resize(n);
+    detail::parallelChunks(pool, n, 4096, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            auto p{parent[i].load(std::memory_order_relaxed)};
+            result.parent[i] = vertexOf[p == none ? i : p];
+        }
+    });
+    return result;
+}
+
+// As above, on a pool with the threads of the policy.
+template<typename Graph>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+BFSResult<Graph> parallelBfs(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+                             execution::Parallel policy = execution::par)
+{
+    auto pool{ThreadPool(policy)};
+    return parallelBfs(g, s, pool);
+}
+
+} // namespace graph
+
+#endif // GRAPH_BREADTH_FIRST_SEARCH_HPP
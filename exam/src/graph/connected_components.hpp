@@ -0,0 +1,245 @@
+/**
+ * connected_components.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * (Weakly) connected components by union-find.
+ */
+#ifndef GRAPH_CONNECTED_COMPONENTS_HPP
+#define GRAPH_CONNECTED_COMPONENTS_HPP
+
+#include "concepts.hpp"
+#include "parallel.hpp"
+#include "traits.hpp"
+
+#include <boost/iterator/iterator_categories.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace graph {
+namespace detail {
+
+// Numbers the components from 0 in the order of their lowest vertex index,
+// given the representative of every vertex.
+template<typename Graph, typename ComponentMap, typename Representative>
+std::size_t writeComponents(const Graph &g, ComponentMap &componentMap, Representative rep)
+{
+    constexpr auto none{std::numeric_limits<std::size_t>::max()};
+    auto n{static_cast<std::size_t>(numVertices(g))};
+    auto id{std::vector<std::size_t>(n, none)};
+    std::size_t numComponents{0};
+    for (std::size_t v = 0; v < n; ++v) {
+        auto &r{id[rep(v)]};
+        if (r == none) {
+            r = numComponents++;
+        }
+    }
+    for (const auto &v : vertices(g)) {
+        put(componentMap, v, id[rep(getIndex(v, g))]);
+    }
+    return numComponents;
+}
+
+} // namespace detail
+
+// Computes the connected components of g, treating every edge as undirected,
+// i.e. the weakly connected components for a directed graph, with a
+// union-find structure using path halving and union by rank. The edges are
+// streamed once through edges(g).
+// The component of each vertex v is written as put(componentMap, v, c), where
+// the components are numbered from 0 in the order of their lowest vertex.
+// Returns the number of components.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph, typename ComponentMap>
+requires EdgeListGraph<Graph> && VertexListGraph<Graph>
+std::size_t connectedComponents(const Graph &g, ComponentMap componentMap,
+                                execution::Sequential = execution::seq)
+{
+    auto n{static_cast<std::size_t>(numVertices(g))};
+    auto parent{std::vector<std::size_t>(n)};
+    auto rank{std::vector<unsigned char>(n, 0)};
+    for (std::size_t v = 0; v < n; ++v) {
+        parent[v] = v;
+    }
+    auto find = [&](std::size_t v) {
+        while (parent[v] != v) {
+            parent[v] = parent[parent[v]];
+            v = parent[v];
+        }
+        return v;
+    };
+
+    for (const auto &e : edges(g)) {
+        auto ru{find(getIndex(source(e, g), g))};
+        auto rv{find(getIndex(target(e, g), g))};
+        if (ru == rv) {
+            continue;
+        }
+        if (rank[ru] < rank[rv]) {
+            std::swap(ru, rv);
+        }
+        parent[rv] = ru;
+        if (rank[ru] == rank[rv]) {
+            ++rank[ru];
+        }
+    }
+    return detail::writeComponents(g, componentMap, find);
+}
+
+// As above, but in parallel with a lock-free union-find in the style of
+// Afforest, Sutton, Ben-Nun and Bar-Noy, IPDPS 2018: a root is always hooked
+// below a lower numbered root by a compare-and-swap. When edges(g) is random
+// access, a sample of the edges, every eighth chunk, is processed first, the
+// trees are flattened, and the largest component is found by sampling
+// vertices. The remaining edges are then skipped when both endpoints already
+// belong to that component, which is most edges of a graph with a giant
+// component. Otherwise the edges are streamed in chunks to all threads.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph, typename ComponentMap>
+requires EdgeListGraph<Graph> && VertexListGraph<Graph>
+std::size_t connectedComponents(const Graph &g, ComponentMap componentMap,
+                                execution::Parallel policy)
+{
+    using EdgeIterator = typename Traits<Graph>::EdgeRange::iterator;
+    using EdgeDescriptor = typename Traits<Graph>::EdgeDescriptor;
+    constexpr std::size_t grain{4096};
+    constexpr std::size_t sampleStride{8};
+    constexpr std::size_t numSamples{1024};
+
+    auto n{static_cast<std::size_t>(numVertices(g))};
+    auto pool{ThreadPool(policy)};
+    auto comp{std::vector<std::atomic<std::size_t>>(n)};
+    detail::parallelChunks(pool, n, grain, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto v = first; v < last; ++v) {
+            comp[v].store(v, std::memory_order_relaxed);
+        }
+    });
+
+    auto load = [&](std::size_t v) {
+        return comp[v].load(std::memory_order_relaxed);
+    };
+    auto link = [&](std::size_t u, std::size_t v) {
+        auto p1{load(u)}, p2{load(v)};
+        while (p1 != p2) {
+            auto high{std::max(p1, p2)}, low{std::min(p1, p2)};
+            auto pHigh{load(high)};
+            if (pHigh == low) {
+                break;
+            }
+            if (pHigh == high && comp[high].compare_exchange_strong(pHigh, low, std::memory_order_relaxed)) {
+                break;
+            }
+            p1 = load(load(high));
+            p2 = load(low);
+        }
+    };
+    auto linkEdge = [&](const EdgeDescriptor &e) {
+        link(getIndex(source(e, g), g), getIndex(target(e, g), g));
+    };
+    auto compress = [&] {
+        detail::parallelChunks(pool, n, grain, [&](std::size_t, std::size_t first, std::size_t last) {
+            for (auto v = first; v < last; ++v) {
+                while (load(v) != load(load(v))) {
+                    comp[v].store(load(load(v)), std::memory_order_relaxed);
+                }
+            }
+        });
+    };
+
+    auto range{edges(g)};
+    using Traversal = typename boost::iterator_traversal<EdgeIterator>::type;
+    if constexpr (std::is_convertible_v<Traversal, boost::random_access_traversal_tag>) {
+        auto first{range.begin()};
+        auto m{static_cast<std::size_t>(range.end() - first)};
+        auto numChunks{(m + grain - 1) / grain};
+        auto processChunk = [&](std::size_t chunk, auto &&skip) {
+            auto last{std::min(m, (chunk + 1) * grain)};
+            for (auto i = chunk * grain; i < last; ++i) {
+                EdgeDescriptor e = first[i];
+                auto u{getIndex(source(e, g), g)}, v{getIndex(target(e, g), g)};
+                if (!skip(u, v)) {
+                    link(u, v);
+                }
+            }
+        };
+
+        // sampling phase
+        auto numSampled{(numChunks + sampleStride - 1) / sampleStride};
+        detail::parallelChunks(pool, numSampled, 1, [&](std::size_t, std::size_t c, std::size_t) {
+            processChunk(c * sampleStride, [](std::size_t, std::size_t) { return false; });
+        });
+        compress();
+
+        auto largest{std::numeric_limits<std::size_t>::max()};
+        if (n > 0) {
+            auto gen{std::mt19937_64(27491095)};
+            auto pick{std::uniform_int_distribution<std::size_t>(0, n - 1)};
+            auto counts{std::unordered_map<std::size_t, std::size_t>{}};
+            std::size_t best{0};
+            for (std::size_t i = 0; i < numSamples; ++i) {
+                auto sampled{load(pick(gen))};
+                auto c{++counts[sampled]};
+                if (c > best) {
+                    best = c;
+                    largest = sampled;
+                }
+            }
+        }
+
+        // the remaining chunks, skipping the edges inside the largest component
+        detail::parallelChunks(pool, numChunks, 1, [&](std::size_t, std::size_t c, std::size_t) {
+            if (c % sampleStride != 0) {
+                processChunk(c, [&](std::size_t u, std::size_t v) {
+                    return load(u) == largest && load(v) == largest;
+                });
+            }
+        });
+    } else {
+        // the edges can only be read in sequence, so threads take turns
+        // copying a chunk of them into a buffer of their own
+        auto it{range.begin()};
+        auto last{range.end()};
+        std::mutex itMutex;
+        pool.run([&](std::size_t) {
+            auto buffer{std::vector<EdgeDescriptor>{}};
+            buffer.reserve(grain);
+            for (;;) {
+                buffer.clear();
+                {
+                    std::lock_guard lock{itMutex};
+                    for (; it != last && buffer.size() < grain; ++it) {
+                        buffer.push_back(*it);
+                    }
+                }
+                if (buffer.empty()) {
+                    return;
+                }
+                for (const auto &e : buffer) {
+                    linkEdge(e);
+                }
+            }
+        });
+    }
+    compress();
+
+    return detail::writeComponents(g, componentMap, [&](std::size_t v) { return load(v); });
+}
+
+} // namespace graph
+
+#endif // GRAPH_CONNECTED_COMPONENTS_HPP
@@ -0,0 +1,223 @@
+/**
+ * core_numbers.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * The k-core decomposition of a graph by peeling vertices of minimum degree.
+ */
+#ifndef GRAPH_CORE_NUMBERS_HPP
+#define GRAPH_CORE_NUMBERS_HPP
+
+#include "concepts.hpp"
+#include "parallel.hpp"
+#include "traits.hpp"
+#include "vertex_index.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// The k-core of a graph is its largest subgraph in which every vertex has
+// degree at least k, and the core number of a vertex is the largest k for
+// which it is in the k-core. The degrees are taken as outDegree, so an
+// undirected graph must be stored with both directions of every edge.
+
+namespace graph {
+
+// Computes the core number of every vertex of g with the bucket algorithm of
+// Batagelj and Zaversnik, "An O(m) Algorithm for Cores Decomposition of
+// Networks", 2003: the vertices are kept sorted by remaining degree in an
+// array with a start position per degree, and removing a vertex of minimum
+// degree moves each neighbour one bucket down by a swap, in O(V + E) total.
+// The core number of each vertex v is written as put(coreMap, v, k).
+// Returns the largest core number, the degeneracy of g.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+// - g is symmetric, i.e. (v, u) is an edge whenever (u, v) is
+template<typename Graph, typename CoreMap>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+std::size_t coreNumbers(const Graph &g, CoreMap coreMap, execution::Sequential = execution::seq)
+{
+    auto vertexOf{detail::indexedVertices(g)};
+    auto n{vertexOf.size()};
+    auto degree{std::vector<std::size_t>(n)};
+    std::size_t maxDegree{0};
+    for (std::size_t v = 0; v < n; ++v) {
+        degree[v] = outDegree(vertexOf[v], g);
+        maxDegree = std::max(maxDegree, degree[v]);
+    }
+
+    // bin[d] is the position of the first vertex of degree d in vert
+    auto bin{std::vector<std::size_t>(maxDegree + 1, 0)};
+    for (auto d : degree) {
+        ++bin[d];
+    }
+    std::size_t start{0};
+    for (auto &b : bin) {
+        auto count{b};
+        b = start;
+        start += count;
+    }
+    auto vert{std::vector<std::size_t>(n)};
+    auto pos{std::vector<std::size_t>(n)};
+    for (std::size_t v = 0; v < n; ++v) {
+        pos[v] = bin[degree[v]]++;
+        vert[pos[v]] = v;
+    }
+    for (auto d = maxDegree; d > 0; --d) {
+        bin[d] = bin[d - 1];
+    }
+    bin[0] = 0;
+
+    std::size_t degeneracy{0};
+    for (std::size_t i = 0; i < n; ++i) {
+        auto v{vert[i]};
+        degeneracy = std::max(degeneracy, degree[v]);
+        for (const auto &e : outEdges(vertexOf[v], g)) {
+            auto u{getIndex(target(e, g), g)};
+            if (degree[u] > degree[v]) {
+                // swap u with the first vertex of its bucket, then shrink it
+                auto du{degree[u]};
+                auto pu{pos[u]};
+                auto pw{bin[du]};
+                auto w{vert[pw]};
+                if (u != w) {
+                    std::swap(vert[pu], vert[pw]);
+                    pos[u] = pw;
+                    pos[w] = pu;
+                }
+                ++bin[du];
+                --degree[u];
+            }
+        }
+    }
+
+    for (std::size_t v = 0; v < n; ++v) {
+        put(coreMap, vertexOf[v], degree[v]);
+    }
+    return degeneracy;
+}
+
+// Computes the core number of every vertex of g in parallel by peeling in
+// rounds: for k = 0, 1, ..., all remaining vertices of degree at most k are
+// removed at once by all threads, decrementing the degrees of their
+// neighbours atomically, and a neighbour whose degree drops to k joins the
+// next sub-round. The remaining vertices are compacted after each k, and k
+// skips directly to their minimum degree.
+// The core number of each vertex v is written as put(coreMap, v, k).
+// Returns the largest core number, the degeneracy of g.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+// - g is symmetric, i.e. (v, u) is an edge whenever (u, v) is
+// - coreMap can be written concurrently for different vertices
+template<typename Graph, typename CoreMap>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+std::size_t coreNumbers(const Graph &g, CoreMap coreMap, execution::Parallel policy)
+{
+    constexpr auto none{std::numeric_limits<std::size_t>::max()};
+    constexpr std::size_t grain{256};
+
+    auto pool{ThreadPool(policy)};
+    auto vertexOf{detail::indexedVertices(g)};
+    auto n{vertexOf.size()};
+    auto degree{std::vector<std::atomic<std::size_t>>(n)};
+    auto removed{std::vector<std::atomic<bool>>(n)};
+    detail::parallelChunks(pool, n, 4096, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto v = first; v < last; ++v) {
+            degree[v].store(outDegree(vertexOf[v], g), std::memory_order_relaxed);
+            removed[v].store(false, std::memory_order_relaxed);
+        }
+    });
+
+    auto alive{std::vector<std::size_t>(n)};
+    for (std::size_t v = 0; v < n; ++v) {
+        alive[v] = v;
+    }
+    auto parts{std::vector<std::vector<std::size_t>>(pool.numThreads())};
+    auto minDegree{std::vector<std::size_t>(pool.numThreads())};
+    auto frontier{std::vector<std::size_t>{}};
+    auto clearParts = [&] {
+        for (auto &p : parts) {
+            p.clear();
+        }
+    };
+
+    // the smallest remaining degree, after which k continues
+    auto smallestDegree = [&] {
+        std::fill(minDegree.begin(), minDegree.end(), none);
+        detail::parallelChunks(pool, alive.size(), 4096,
+                               [&](std::size_t tid, std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i) {
+                minDegree[tid] = std::min(minDegree[tid],
+                                          degree[alive[i]].load(std::memory_order_relaxed));
+            }
+        });
+        return *std::min_element(minDegree.begin(), minDegree.end());
+    };
+
+    std::size_t degeneracy{0};
+    while (!alive.empty()) {
+        auto k{std::max(degeneracy, smallestDegree())};
+        degeneracy = k;
+
+        clearParts();
+        detail::parallelChunks(pool, alive.size(), 4096,
+                               [&](std::size_t tid, std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i) {
+                if (degree[alive[i]].load(std::memory_order_relaxed) <= k) {
+                    parts[tid].push_back(alive[i]);
+                }
+            }
+        });
+        detail::parallelConcat(pool, parts, frontier);
+
+        while (!frontier.empty()) {
+            for (auto v : frontier) {
+                removed[v].store(true, std::memory_order_relaxed);
+            }
+            clearParts();
+            detail::parallelChunks(pool, frontier.size(), grain,
+                                   [&](std::size_t tid, std::size_t first, std::size_t last) {
+                for (auto i = first; i < last; ++i) {
+                    auto v{frontier[i]};
+                    put(coreMap, vertexOf[v], k);
+                    for (const auto &e : outEdges(vertexOf[v], g)) {
+                        auto u{getIndex(target(e, g), g)};
+                        if (removed[u].load(std::memory_order_relaxed)) {
+                            continue;
+                        }
+                        // exactly one decrement takes u from k + 1 to k
+                        if (degree[u].fetch_sub(1, std::memory_order_relaxed) == k + 1) {
+                            parts[tid].push_back(u);
+                        }
+                    }
+                }
+            });
+            detail::parallelConcat(pool, parts, frontier);
+        }
+
+        clearParts();
+        detail::parallelChunks(pool, alive.size(), 4096,
+                               [&](std::size_t tid, std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i) {
+                if (!removed[alive[i]].load(std::memory_order_relaxed)) {
+                    parts[tid].push_back(alive[i]);
+                }
+            }
+        });
+        detail::parallelConcat(pool, parts, alive);
+        ++degeneracy;
+    }
+    return n == 0 ? 0 : degeneracy - 1;
+}
+
+} // namespace graph
+
+#endif // GRAPH_CORE_NUMBERS_HPP
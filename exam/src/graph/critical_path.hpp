@@ -0,0 +1,209 @@
+/**
+ * critical_path.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Critical path analysis of a DAG of tasks with durations.
+ */
+#ifndef GRAPH_CRITICAL_PATH_HPP
+#define GRAPH_CRITICAL_PATH_HPP
+
+#include "concepts.hpp"
+#include "parallel.hpp"
+#include "topological_sort.hpp"
+#include "traits.hpp"
+
+#include <atomic>
+#include <limits>
+#include <vector>
+
+// Every vertex is a task taking get(durationMap, v) time, and an edge (u, v)
+// means that v cannot start before u has finished. The earliest start of a
+// task is the latest finish of its predecessors, and its latest start is the
+// latest time it can start without delaying the makespan, the earliest time
+// all tasks can be finished. The slack of a task is the difference, and the
+// critical tasks, those without slack, form chains from a first to a last
+// task whose durations sum to the makespan.
+
+namespace graph {
+
+// The outcome of criticalPath, indexed by getIndex(v, g).
+template<typename Graph, typename Duration>
+struct CriticalPathResult
+{
+    std::vector<Duration> earliestStart, latestStart, slack;
+    Duration makespan{};
+    // A critical chain in dependency order.
+    std::vector<typename Traits<Graph>::VertexDescriptor> chain;
+};
+
+namespace detail {
+
+template<typename Duration>
+void atomicMax(std::atomic<Duration> &a, Duration value)
+{
+    auto current{a.load(std::memory_order_relaxed)};
+    while (current < value
+           && !a.compare_exchange_weak(current, value, std::memory_order_relaxed)) { }
+}
+
+// The forward pass pushes the finish times of each level to the earliest
+// starts of its successors, and the backward pass pulls the latest starts of
+// the successors of each level, from the last level to the first.
+template<typename Graph, typename DurationMap>
+CriticalPathResult<Graph, typename DurationMap::Value>
+criticalPath(const Graph &g, const DurationMap &durationMap,
+             const std::vector<std::vector<typename Traits<Graph>::VertexDescriptor>> &levels,
+             ThreadPool &pool)
+{
+    using Duration = typename DurationMap::Value;
+    constexpr std::size_t grain{256};
+
+    auto n{static_cast<std::size_t>(numVertices(g))};
+    auto result{CriticalPathResult<Graph, Duration>{}};
+    auto earliest{std::vector<std::atomic<Duration>>(n)};
+    for (auto &es : earliest) {
+        es.store(Duration{}, std::memory_order_relaxed);
+    }
+
+    for (const auto &level : levels) {
+        parallelChunks(pool, level.size(), grain, [&](std::size_t, std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i) {
+                const auto &u{level[i]};
+                Duration finish = earliest[getIndex(u, g)].load(std::memory_order_relaxed)
+                                + get(durationMap, u);
+                for (const auto &e : outEdges(u, g)) {
+                    atomicMax(earliest[getIndex(target(e, g), g)], finish);
+                }
+            }
+        });
+    }
+    result.earliestStart.resize(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        result.earliestStart[v] = earliest[v].load(std::memory_order_relaxed);
+    }
+    for (const auto &level : levels) {
+        for (const auto &v : level) {
+            Duration finish = result.earliestStart[getIndex(v, g)] + get(durationMap, v);
+            if (result.makespan < finish) {
+                result.makespan = finish;
+            }
+        }
+    }
+
+    result.latestStart.resize(n);
+    result.slack.resize(n);
+    for (auto l = levels.size(); l-- > 0;) {
+        const auto &level{levels[l]};
+        parallelChunks(pool, level.size(), grain, [&](std::size_t, std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i) {
+                const auto &u{level[i]};
+                auto latestFinish{result.makespan};
+                for (const auto &e : outEdges(u, g)) {
+                    const auto &ls{result.latestStart[getIndex(target(e, g), g)]};
+                    if (ls < latestFinish) {
+                        latestFinish = ls;
+                    }
+                }
+                auto ui{getIndex(u, g)};
+                result.latestStart[ui] = latestFinish - get(durationMap, u);
+                result.slack[ui] = result.latestStart[ui] - result.earliestStart[ui];
+            }
+        });
+    }
+
+    // Start at the first task with the least latest start, and follow the
+    // successor with the least latest start, which is the one that bounds the
+    // latest finish of the current task, until a last task.
+    if (levels.empty() || levels.front().empty()) {
+        return result;
+    }
+    auto v{levels.front().front()};
+    for (const auto &u : levels.front()) {
+        if (result.latestStart[getIndex(u, g)] < result.latestStart[getIndex(v, g)]) {
+            v = u;
+        }
+    }
+    for (;;) {
+        result.chain.push_back(v);
+        auto out{outEdges(v, g)};
+        if (out.begin() == out.end()) {
+            break;
+        }
+        auto next{target(*out.begin(), g)};
+        for (const auto &e : out) {
+            if (result.latestStart[getIndex(target(e, g), g)] < result.latestStart[getIndex(next, g)]) {
+                next = target(e, g);
+            }
+        }
+        v = next;
+    }
+    return result;
+}
+
+} // namespace detail
+
+// Computes the earliest and latest start and the slack of every task, the
+// makespan, and a critical chain, with a forward and a backward pass over the
+// topological levels of g, as given by topoSortLevels, in O(V + E) time.
+// Throws NotADagError if g is not acyclic.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+// - all durations are non-negative
+// - the durations support std::atomic, e.g. built-in arithmetic types
+template<typename Graph, typename DurationMap>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+CriticalPathResult<Graph, typename DurationMap::Value>
+criticalPath(const Graph &g, DurationMap durationMap, execution::Sequential = execution::seq)
+{
+    auto pool{ThreadPool(1)};
+    return detail::criticalPath(g, durationMap, topoSortLevels(g, execution::Parallel{1}), pool);
+}
+
+// As above, where each level is processed by all threads of the policy. The
+// earliest starts of the successors of a level are raised by an atomic
+// maximum, and the latest starts of a level only read those of later levels.
+template<typename Graph, typename DurationMap>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+CriticalPathResult<Graph, typename DurationMap::Value>
+criticalPath(const Graph &g, DurationMap durationMap, execution::Parallel policy)
+{
+    auto pool{ThreadPool(policy)};
+    return detail::criticalPath(g, durationMap, topoSortLevels(g, policy), pool);
+}
+
+// As above, reusing levels already computed by topoSortLevels(g), e.g. to
+// recompute the slack after durations have changed, which does not change
+// the levels.
+// The following pre-conditions are required:
+// - levels is the result of topoSortLevels(g) for the current edges of g
+template<typename Graph, typename DurationMap>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+CriticalPathResult<Graph, typename DurationMap::Value>
+criticalPath(const Graph &g, DurationMap durationMap,
+             const std::vector<std::vector<typename Traits<Graph>::VertexDescriptor>> &levels,
+             execution::Sequential = execution::seq)
+{
+    auto pool{ThreadPool(1)};
+    return detail::criticalPath(g, durationMap, levels, pool);
+}
+
+template<typename Graph, typename DurationMap>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+CriticalPathResult<Graph, typename DurationMap::Value>
+criticalPath(const Graph &g, DurationMap durationMap,
+             const std::vector<std::vector<typename Traits<Graph>::VertexDescriptor>> &levels,
+             execution::Parallel policy)
+{
+    auto pool{ThreadPool(policy)};
+    return detail::criticalPath(g, durationMap, levels, pool);
+}
+
+} // namespace graph
+
+#endif // GRAPH_CRITICAL_PATH_HPP
@@ -0,0 +1,189 @@
+/**
+ * d_ary_heap.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * An indexed d-ary heap with decrease-key, used as the priority queue of the
+ * shortest path algorithms.
+ */
+#ifndef GRAPH_D_ARY_HEAP_HPP
+#define GRAPH_D_ARY_HEAP_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+// A min-heap, with respect to Compare, of entries each holding a priority, a
+// value and an index in [0, capacity()). The position of every index in the
+// heap is tracked, so the priority of an entry can be decreased in place
+// instead of inserting a duplicate. All storage is kept when the heap runs
+// empty, so a heap can be reused for many searches without reallocating.
+template<typename Value, typename Priority, std::size_t Arity = 4,
+         typename Compare = std::less<Priority>>
+class IndexedDAryHeap
+{
+    static_assert(Arity >= 2);
+
+public:
+    struct Entry
+    {
+        Priority priority;
+        std::size_t index;
+        Value value;
+    };
+
+public:
+    IndexedDAryHeap() = default;
+
+    explicit IndexedDAryHeap(std::size_t capacity, Compare comp = Compare{})
+        : pos(capacity, npos), comp(std::move(comp)) { }
+
+public:
+    std::size_t capacity() const
+    {
+        return pos.size();
+    }
+
+    // Makes room for the indices [0, capacity).
+    void reserve(std::size_t capacity)
+    {
+        if (capacity > pos.size()) {
+            pos.resize(capacity, npos);
+        }
+    }
+
+    bool empty() const
+    {
+        return heap.empty();
+    }
+
+    std::size_t size() const
+    {
+        return heap.size();
+    }
+
+    bool contains(std::size_t index) const
+    {
+        return pos[index] != npos;
+    }
+
+    const Priority &priority(std::size_t index) const
+    {
+        return heap[pos[index]].priority;
+    }
+
+    // The following pre-conditions are required:
+    // - the heap is not empty
+    const Entry &top() const
+    {
+        return heap.front();
+    }
+
+    // The following pre-conditions are required:
+    // - index < capacity() and !contains(index)
+    void push(std::size_t index, Value value, Priority priority)
+    {
+        assert(!contains(index));
+        heap.push_back(Entry{std::move(priority), index, std::move(value)});
+        siftUp(heap.size() - 1);
+    }
+
+    // The following pre-conditions are required:
+    // - contains(index), and priority is not greater than its current priority
+    void decrease(std::size_t index, Priority priority)
+    {
+        assert(contains(index) && !comp(heap[pos[index]].priority, priority));
+        heap[pos[index]].priority = std::move(priority);
+        siftUp(pos[index]);
+    }
+
+    // The following pre-conditions are required:
+    // - the heap is not empty
+    void pop()
+    {
+        pos[heap.front().index] = npos;
+        if (heap.size() > 1) {
+            heap.front() = std::move(heap.back());
+            heap.pop_back();
+            siftDown(0);
+        } else {
+            heap.pop_back();
+        }
+    }
+
+    // Removes all entries, in time proportional to their number.
+    void clear()
+    {
+        for (const auto &e : heap) {
+            pos[e.index] = npos;
+        }
+        heap.clear();
+    }
+
+private:
+    void place(std::size_t i, Entry &&e)
+    {
+        pos[e.index] = i;
+        heap[i] = std::move(e);
+    }
+
+    void siftUp(std::size_t i)
+    {
+        auto e{std::move(heap[i])};
+        while (i > 0) {
+            auto parent{(i - 1) / Arity};
+            if (!comp(e.priority, heap[parent].priority)) {
+                break;
+            }
+            place(i, std::move(heap[parent]));
+            i = parent;
+        }
+        place(i, std::move(e));
+    }
+
+    void siftDown(std::size_t i)
+    {
+        auto e{std::move(heap[i])};
+        auto n{heap.size()};
+        for (;;) {
+            auto first{i * Arity + 1};
+            if (first >= n) {
+                break;
+            }
+            auto last{first + Arity < n ? first + Arity : n};
+            auto best{first};
+            for (auto c = first + 1; c < last; ++c) {
+                if (comp(heap[c].priority, heap[best].priority)) {
+                    best = c;
+                }
+            }
+            if (!comp(heap[best].priority, e.priority)) {
+                break;
+            }
+            place(i, std::move(heap[best]));
+            i = best;
+        }
+        place(i, std::move(e));
+    }
+
+private:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    std::vector<Entry> heap;
+    std::vector<std::size_t> pos; // index -> position in heap, or npos
+    Compare comp;
+};
+
+} // namespace graph
+
+#endif // GRAPH_D_ARY_HEAP_HPP
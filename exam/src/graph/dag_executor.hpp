@@ -0,0 +1,191 @@
+/**
+ * dag_executor.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Parallel execution of a task per vertex of a dependency DAG.
+ */
+#ifndef GRAPH_DAG_EXECUTOR_HPP
+#define GRAPH_DAG_EXECUTOR_HPP
+
+#include "concepts.hpp"
+#include "parallel.hpp"
+#include "topological_sort.hpp"
+#include "traits.hpp"
+#include "vertex_index.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+enum struct TaskStatus {
+    Succeeded, // the task ran and returned normally
+    Failed,    // the task ran and threw an exception
+    Skipped    // the task was not run, as a dependency failed or was skipped
+};
+
+// What happens to the remaining tasks once a task has failed.
+enum struct FailurePolicy {
+    // Only the tasks depending, directly or indirectly, on it are skipped.
+    SkipDependents,
+    // No further tasks are started.
+    CancelAll
+};
+
+struct TaskTiming
+{
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point start, finish;
+
+    Clock::duration duration() const
+    {
+        return finish - start;
+    }
+};
+
+// The outcome of executeDag, indexed by getIndex(v, g).
+struct DagExecutionReport
+{
+    std::vector<TaskStatus> status;
+    // Start and finish time of each task that ran.
+    std::vector<TaskTiming> timing;
+    // The exception thrown by each failed task.
+    std::vector<std::exception_ptr> error;
+
+    bool succeeded() const
+    {
+        for (auto s : status) {
+            if (s != TaskStatus::Succeeded) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Calls task(v) for every vertex v of the dependency graph g, where an edge
+// (u, v) means that v depends on u. A task is started as soon as all of its
+// predecessors have finished: each vertex has an atomic counter of unfinished
+// predecessors, and the thread finishing the last of them queues the vertex
+// on a work-stealing pool.
+// The tasks run on the threads of pool.
+// If a task throws, the exception is recorded in the report and the
+// remaining tasks are skipped as given by onFailure.
+// Throws NotADagError, before running any task, if g is not acyclic.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+// - task may be called concurrently for different vertices
+template<typename Graph, typename Task>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+DagExecutionReport executeDag(const Graph &g, Task &&task, ThreadPool &pool,
+                              FailurePolicy onFailure = FailurePolicy::SkipDependents)
+{
+    auto n{static_cast<std::size_t>(numVertices(g))};
+    auto vertexOf{detail::indexedVertices(g)};
+
+    auto inDeg{std::vector<std::size_t>(n, 0)};
+    for (std::size_t u = 0; u < n; ++u) {
+        for (const auto &e : outEdges(vertexOf[u], g)) {
+            ++inDeg[getIndex(target(e, g), g)];
+        }
+    }
+
+    // Check for cycles with a sequential Kahn pass, so that no task runs
+    // unless all of them can.
+    auto sources{std::vector<std::size_t>{}};
+    for (std::size_t u = 0; u < n; ++u) {
+        if (inDeg[u] == 0) {
+            sources.push_back(u);
+        }
+    }
+    {
+        auto remaining{inDeg};
+        auto queue{sources};
+        for (std::size_t i = 0; i < queue.size(); ++i) {
+            for (const auto &e : outEdges(vertexOf[queue[i]], g)) {
+                auto v{getIndex(target(e, g), g)};
+                if (--remaining[v] == 0) {
+                    queue.push_back(v);
+                }
+            }
+        }
+        if (queue.size() != n) {
+            auto candidate{std::vector<bool>(n)};
+            for (std::size_t u = 0; u < n; ++u) {
+                candidate[u] = remaining[u] != 0;
+            }
+            throw NotADagError(detail::findCycle(g, vertexOf, candidate));
+        }
+    }
+
+    auto pending{std::vector<std::atomic<std::size_t>>(n)};
+    auto poisoned{std::vector<std::atomic<bool>>(n)};
+    for (std::size_t u = 0; u < n; ++u) {
+        pending[u].store(inDeg[u], std::memory_order_relaxed);
+        poisoned[u].store(false, std::memory_order_relaxed);
+    }
+    std::atomic<bool> cancelled{false};
+
+    auto report{DagExecutionReport{}};
+    report.status.resize(n);
+    report.timing.resize(n);
+    report.error.resize(n);
+
+    detail::workStealing(pool, sources, [&](std::size_t, std::size_t u, auto &&push) {
+        if (poisoned[u].load(std::memory_order_relaxed)
+                || cancelled.load(std::memory_order_relaxed)) {
+            report.status[u] = TaskStatus::Skipped;
+        } else {
+            report.timing[u].start = TaskTiming::Clock::now();
+            try {
+                task(vertexOf[u]);
+                report.status[u] = TaskStatus::Succeeded;
+            } catch (...) {
+                report.status[u] = TaskStatus::Failed;
+                report.error[u] = std::current_exception();
+                if (onFailure == FailurePolicy::CancelAll) {
+                    cancelled.store(true, std::memory_order_relaxed);
+                }
+            }
+            report.timing[u].finish = TaskTiming::Clock::now();
+        }
+        auto ok{report.status[u] == TaskStatus::Succeeded};
+        for (const auto &e : outEdges(vertexOf[u], g)) {
+            auto v{getIndex(target(e, g), g)};
+            if (!ok) {
+                poisoned[v].store(true, std::memory_order_relaxed);
+            }
+            // acq_rel, so the thread running v sees the results of all its
+            // predecessors, and whether any of them poisoned it
+            if (pending[v].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                push(v);
+            }
+        }
+    });
+    return report;
+}
+
+// As above, on a pool with the threads of the policy.
+template<typename Graph, typename Task>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+DagExecutionReport executeDag(const Graph &g, Task &&task,
+                              execution::Parallel policy = execution::par,
+                              FailurePolicy onFailure = FailurePolicy::SkipDependents)
+{
+    auto pool{ThreadPool(policy)};
+    return executeDag(g, std::forward<Task>(task), pool, onFailure);
+}
+
+} // namespace graph
+
+#endif // GRAPH_DAG_EXECUTOR_HPP
@@ -0,0 +1,180 @@
+/**
+ * delta_stepping.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Parallel single-source shortest paths by delta-stepping, Meyer and Sanders,
+ * "Delta-stepping: a parallelizable shortest path algorithm", J. Algorithms
+ * 49(1), 2003.
+ */
+#ifndef GRAPH_DELTA_STEPPING_HPP
+#define GRAPH_DELTA_STEPPING_HPP
+
+#include "concepts.hpp"
+#include "dijkstra.hpp"
+#include "parallel.hpp"
+#include "traits.hpp"
+#include "vertex_index.hpp"
+
+#include <atomic>
+#include <limits>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+// Computes the distances from s to all vertices of g, like dijkstra, but
+// settles a whole bucket of tentative distances [i * delta, (i + 1) * delta)
+// at a time. Within a bucket the light edges, weight <= delta, are relaxed in
+// parallel until the bucket stays empty, and then the heavy edges of all
+// vertices removed from it are relaxed in parallel once. Distances are lowered
+// with an atomic compare-and-swap, and every thread stages the vertices it
+// improves, which are moved into the buckets after each parallel phase. Only
+// the buckets holding vertices are kept, indexed sparsely by number, so
+// neither memory nor the search for the next bucket depends on the largest
+// weight or distance, however small delta is.
+// A small delta gives little parallelism per bucket, a large one gives many
+// re-relaxations; the average edge weight is a reasonable start.
+// Returns the distance of each vertex v at getIndex(v, g), which is
+// infiniteDistance<Distance>() if v cannot be reached.
+// The following pre-conditions are required:
+// - s is a valid vertex descriptor for g
+// - all weights are non-negative, and delta is positive
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph, typename WeightMap,
+         typename Distance = std::remove_cvref_t<
+             decltype(get(std::declval<WeightMap>(),
+                          std::declval<typename Traits<Graph>::EdgeDescriptor>()))>>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+std::vector<Distance> deltaStepping(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+                                    WeightMap weightMap, Distance delta,
+                                    execution::Parallel policy = execution::par)
+{
+    constexpr std::size_t grain{64};
+    constexpr auto noBucket{std::numeric_limits<std::size_t>::max()};
+
+    auto n{static_cast<std::size_t>(numVertices(g))};
+    auto pool{ThreadPool(policy)};
+    auto numThreads{pool.numThreads()};
+
+    auto vertexOf{detail::indexedVertices(g)};
+    auto dist{std::vector<std::atomic<Distance>>(n)};
+    // the bucket, plus one, in which a vertex was last removed, so the heavy
+    // edges of a vertex are relaxed once per bucket
+    auto removedIn{std::vector<std::atomic<std::size_t>>(n)};
+    detail::parallelChunks(pool, n, 4096, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            dist[i].store(infiniteDistance<Distance>(), std::memory_order_relaxed);
+            removedIn[i].store(0, std::memory_order_relaxed);
+        }
+    });
+
+    auto bucketOf = [delta](Distance d) {
+        return static_cast<std::size_t>(d / delta);
+    };
+
+    // the vertices of each non-empty bucket, and those improved during the
+    // current phase by each thread, with the bucket they belong in
+    auto buckets{std::map<std::size_t, std::vector<std::size_t>>{}};
+    auto staged{std::vector<std::vector<std::pair<std::size_t, std::size_t>>>(numThreads)};
+    auto relax = [&](std::size_t tid, std::size_t v, Distance nd) {
+        auto old{dist[v].load(std::memory_order_relaxed)};
+        while (nd < old) {
+            if (dist[v].compare_exchange_weak(old, nd, std::memory_order_relaxed)) {
+                staged[tid].emplace_back(bucketOf(nd), v);
+                return;
+            }
+        }
+    };
+    // Moves the staged vertices into their buckets once a phase is done,
+    // dropping those improved again since, which are staged for a lower bucket.
+    auto flush = [&] {
+        for (auto &stage : staged) {
+            for (auto [b, v] : stage) {
+                if (bucketOf(dist[v].load(std::memory_order_relaxed)) == b) {
+                    buckets[b].push_back(v);
+                }
+            }
+            stage.clear();
+        }
+    };
+    auto takeBucket = [&](std::size_t b, std::vector<std::size_t> &out) {
+        out.clear();
+        if (auto it{buckets.find(b)}; it != buckets.end()) {
+            out.swap(it->second);
+            buckets.erase(it);
+        }
+    };
+
+    dist[getIndex(s, g)].store(Distance{}, std::memory_order_relaxed);
+    buckets[0].push_back(getIndex(s, g));
+
+    auto frontier{std::vector<std::size_t>{}};
+    auto removed{std::vector<std::vector<std::size_t>>(numThreads)};
+    auto settled{std::vector<std::size_t>{}};
+    for (std::size_t cur = 0; cur != noBucket;) {
+        for (auto &r : removed) {
+            r.clear();
+        }
+        // light edges, until no vertex falls back into the current bucket
+        for (takeBucket(cur, frontier); !frontier.empty(); takeBucket(cur, frontier)) {
+            detail::parallelChunks(pool, frontier.size(), grain,
+                                   [&](std::size_t tid, std::size_t first, std::size_t last) {
+                for (auto i = first; i < last; ++i) {
+                    auto u{frontier[i]};
+                    auto du{dist[u].load(std::memory_order_relaxed)};
+                    if (bucketOf(du) != cur) {
+                        continue; // a stale entry of a vertex improved since
+                    }
+                    if (removedIn[u].exchange(cur + 1, std::memory_order_relaxed) != cur + 1) {
+                        removed[tid].push_back(u);
+                    }
+                    for (const auto &e : outEdges(vertexOf[u], g)) {
+                        Distance w = get(weightMap, e);
+                        if (w <= delta) {
+                            relax(tid, getIndex(target(e, g), g), du + w);
+                        }
+                    }
+                }
+            });
+            flush();
+        }
+
+        // heavy edges, which always lead to a later bucket
+        detail::parallelConcat(pool, removed, settled);
+        detail::parallelChunks(pool, settled.size(), grain,
+                               [&](std::size_t tid, std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i) {
+                auto u{settled[i]};
+                auto du{dist[u].load(std::memory_order_relaxed)};
+                for (const auto &e : outEdges(vertexOf[u], g)) {
+                    Distance w = get(weightMap, e);
+                    if (w > delta) {
+                        relax(tid, getIndex(target(e, g), g), du + w);
+                    }
+                }
+            }
+        });
+
+        flush();
+
+        cur = buckets.empty() ? noBucket : buckets.begin()->first;
+    }
+
+    auto result{std::vector<Distance>(n)};
+    for (std::size_t i = 0; i < n; ++i) {
+        result[i] = dist[i].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+} // namespace graph
+
+#endif // GRAPH_DELTA_STEPPING_HPP
@@ -9,95 +9,485 @@
  * 2022-06-15
  *
  * This file was provided but has been changed to implement task 2a.
+ * Visitor hooks returning a DFSControl were added later to stop or prune
+ * the search, and hooks a visitor does not override are now skipped at
+ * compile time. For that the hooks of DFSNullVisitor return the empty
+ * detail::DFSNullHook instead of void, while the hooks of other visitors may
+ * still return void or DFSControl. The overloads taking a colour map are
+ * constexpr, so with a map over a std::array the search can run on a
+ * StaticGraph during constant evaluation. Those using a TraversalWorkspace
+ * allocate, so they are not.
  */
 #ifndef GRAPH_DEPTH_FIRST_SEARCH_HPP
 #define GRAPH_DEPTH_FIRST_SEARCH_HPP
 
+#include "property_map.hpp"
 #include "traits.hpp"
+#include "traversal_workspace.hpp"
 
+#include <concepts>
 #include <iostream>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace graph {
 
+namespace detail {
+
+// The result of the hooks of DFSNullVisitor, so the search can tell from the
+// type of a call to a hook whether it resolves to one of them.
+struct DFSNullHook {};
+
+} // namespace detail
+
 struct DFSNullVisitor {
 	template<typename G, typename V>
-	void initVertex(const V& v, const G& g) { }
+	constexpr detail::DFSNullHook initVertex(const V& v, const G& g) { return {}; }
 
 	template<typename G, typename V>
-	void startVertex(const V& v, const G& g) { }
+	constexpr detail::DFSNullHook startVertex(const V& v, const G& g) { return {}; }
 
 	template<typename G, typename V>
-	void discoverVertex(const V& v, const G& g) { }
+	constexpr detail::DFSNullHook discoverVertex(const V& v, const G& g) { return {}; }
 
 	template<typename G, typename V>
-	void finishVertex(const V& v, const G& g) { }
+	constexpr detail::DFSNullHook finishVertex(const V& v, const G& g) { return {}; }
 
 	template<typename G, typename E>
-	void examineEdge(const E& e, const G& g) { }
+	constexpr detail::DFSNullHook examineEdge(const E& e, const G& g) { return {}; }
 
 	template<typename G, typename E>
-	void treeEdge(const E& e, const G& g) { }
+	constexpr detail::DFSNullHook treeEdge(const E& e, const G& g) { return {}; }
 
 	template<typename G, typename E>
-	void backEdge(const E& e, const G& g) { }
+	constexpr detail::DFSNullHook backEdge(const E& e, const G& g) { return {}; }
 
 	template<typename G, typename E>
-	void forwardOrCrossEdge(const E& e, const G& g) { }
+	constexpr detail::DFSNullHook forwardOrCrossEdge(const E& e, const G& g) { return {}; }
 
 	template<typename G, typename E>
-	void finishEdge(const E& e, const G& g) { }
+	constexpr detail::DFSNullHook finishEdge(const E& e, const G& g) { return {}; }
+};
+
+// A visitor hook may return a DFSControl instead of void to steer the search.
+// Hooks returning void always continue, and cost nothing extra.
+enum struct DFSControl {
+    // Proceed as usual.
+    Continue,
+    // From discoverVertex: do not explore the out-edges of the vertex.
+    // From examineEdge: skip the edge, without classifying or finishing it.
+    // From treeEdge: do not descend into the target, which stays undiscovered.
+    // From startVertex: do not start a search from the vertex.
+    // From any other hook: the same as Continue.
+    Prune,
+    // End the search at once. No further hooks are called, so the vertices
+    // being explored are never finished.
+    Stop
 };
 
 namespace detail {
 
-enum struct DFSColour {
-	White, Grey, Black
+// Calls a hook, turning a void result into DFSControl::Continue.
+template<typename Hook>
+constexpr DFSControl dfsHook(Hook &&hook)
+{
+    using Result = std::invoke_result_t<Hook>;
+    static_assert(std::is_void_v<Result> || std::same_as<Result, DFSControl>
+                      || std::same_as<Result, DFSNullHook>,
+                  "DFS visitor hooks must return void or DFSControl");
+    if constexpr (!std::same_as<Result, DFSControl>) {
+        hook();
+        return DFSControl::Continue;
+    } else {
+        return hook();
+    }
+}
+
+// The events of a depth-first search, one per visitor hook.
+enum DFSEvent : unsigned {
+    InitVertex = 1 << 0,
+    StartVertex = 1 << 1,
+    DiscoverVertex = 1 << 2,
+    FinishVertex = 1 << 3,
+    ExamineEdge = 1 << 4,
+    TreeEdge = 1 << 5,
+    BackEdge = 1 << 6,
+    ForwardOrCrossEdge = 1 << 7,
+    FinishEdge = 1 << 8,
+    EdgeEvents = ExamineEdge | TreeEdge | BackEdge | ForwardOrCrossEdge | FinishEdge
 };
 
-template<typename Graph, typename Visitor>
-void dfsVisit(const Graph &g, Visitor visitor, typename Traits<Graph>::VertexDescriptor u,
-		      std::vector<DFSColour> &colour)
-{
-    visitor.discoverVertex(u, g);
-    colour[getIndex(u, g)] = DFSColour::Grey;
-    auto u_out_edges{outEdges(u, g)};
-    for (const auto &e : u_out_edges) {
-        auto v{target(e, g)};
-        visitor.examineEdge(e, g);
-        if (colour[getIndex(v, g)] == DFSColour::White) {
-            visitor.treeEdge(e, g);
-            dfsVisit(g, visitor, v, colour);
-        } else if (colour[getIndex(v, g)] == DFSColour::Grey) {
-            visitor.backEdge(e, g);
-        } else if (colour[getIndex(v, g)] == DFSColour::Black) {
-            visitor.forwardOrCrossEdge(e, g);
-        }
-        visitor.finishEdge(e, g);
+// Tags for the visitor hooks, each holding its event and calling the hook,
+// where the call operator only exists if the call of the hook is well-formed.
+struct InitVertexHook
+{
+    static constexpr DFSEvent event = InitVertex;
+
+    template<typename Visitor, typename Arg, typename Graph>
+    constexpr auto operator()(Visitor &visitor, const Arg &a, const Graph &g) const
+        -> decltype(visitor.initVertex(a, g))
+    {
+        return visitor.initVertex(a, g);
+    }
+};
+
+struct StartVertexHook
+{
+    static constexpr DFSEvent event = StartVertex;
+
+    template<typename Visitor, typename Arg, typename Graph>
+    constexpr auto operator()(Visitor &visitor, const Arg &a, const Graph &g) const
+        -> decltype(visitor.startVertex(a, g))
+    {
+        return visitor.startVertex(a, g);
+    }
+};
+
+struct DiscoverVertexHook
+{
+    static constexpr DFSEvent event = DiscoverVertex;
+
+    template<typename Visitor, typename Arg, typename Graph>
+    constexpr auto operator()(Visitor &visitor, const Arg &a, const Graph &g) const
+        -> decltype(visitor.discoverVertex(a, g))
+    {
+        return visitor.discoverVertex(a, g);
+    }
+};
+
+struct FinishVertexHook
+{
+    static constexpr DFSEvent event = FinishVertex;
+
+    template<typename Visitor, typename Arg, typename Graph>
+    constexpr auto operator()(Visitor &visitor, const Arg &a, const Graph &g) const
+        -> decltype(visitor.finishVertex(a, g))
+    {
+        return visitor.finishVertex(a, g);
     }
-    colour[getIndex(u, g)] = DFSColour::Black;
-    visitor.finishVertex(u, g);
+};
+
+struct ExamineEdgeHook
+{
+    static constexpr DFSEvent event = ExamineEdge;
+
+    template<typename Visitor, typename Arg, typename Graph>
+    constexpr auto operator()(Visitor &visitor, const Arg &a, const Graph &g) const
+        -> decltype(visitor.examineEdge(a, g))
+    {
+        return visitor.examineEdge(a, g);
+    }
+};
+
+struct TreeEdgeHook
+{
+    static constexpr DFSEvent event = TreeEdge;
+
+    template<typename Visitor, typename Arg, typename Graph>
+    constexpr auto operator()(Visitor &visitor, const Arg &a, const Graph &g) const
+        -> decltype(visitor.treeEdge(a, g))
+    {
+        return visitor.treeEdge(a, g);
+    }
+};
+
+struct BackEdgeHook
+{
+    static constexpr DFSEvent event = BackEdge;
+
+    template<typename Visitor, typename Arg, typename Graph>
+    constexpr auto operator()(Visitor &visitor, const Arg &a, const Graph &g) const
+        -> decltype(visitor.backEdge(a, g))
+    {
+        return visitor.backEdge(a, g);
+    }
+};
+
+struct ForwardOrCrossEdgeHook
+{
+    static constexpr DFSEvent event = ForwardOrCrossEdge;
+
+    template<typename Visitor, typename Arg, typename Graph>
+    constexpr auto operator()(Visitor &visitor, const Arg &a, const Graph &g) const
+        -> decltype(visitor.forwardOrCrossEdge(a, g))
+    {
+        return visitor.forwardOrCrossEdge(a, g);
+    }
+};
+
+struct FinishEdgeHook
+{
+    static constexpr DFSEvent event = FinishEdge;
+
+    template<typename Visitor, typename Arg, typename Graph>
+    constexpr auto operator()(Visitor &visitor, const Arg &a, const Graph &g) const
+        -> decltype(visitor.finishEdge(a, g))
+    {
+        return visitor.finishEdge(a, g);
+    }
+};
+
+// Whether calling Hook on a Visitor with an Arg resolves to the hook of
+// DFSNullVisitor, whatever Visitor declares besides it. If the call cannot
+// be checked, the hook is taken to be overridden, so it is still called.
+template<typename Hook, typename Visitor, typename Arg, typename Graph>
+concept CallsNullHook = requires(Hook hook, Visitor &visitor, const Arg &a, const Graph &g) {
+    { hook(visitor, a, g) } -> std::same_as<DFSNullHook>;
+};
+
+// The event of Hook, or nothing if the hook resolves to DFSNullVisitor.
+template<typename Hook, typename Visitor, typename Arg, typename Graph>
+constexpr unsigned dfsEvent()
+{
+    return CallsNullHook<Hook, Visitor, Arg, Graph> ? 0u : static_cast<unsigned>(Hook::event);
 }
 
-} // namespace detail
+// The events for which Visitor overrides the hook of DFSNullVisitor. The
+// search skips the others at compile time, and runs a loop without edge
+// classification when no edge events are needed, e.g. for topoSort, which
+// only needs finishVertex.
+template<typename Visitor, typename Graph>
+constexpr unsigned dfsEvents()
+{
+    using V = typename Traits<Graph>::VertexDescriptor;
+    using E = typename Traits<Graph>::EdgeDescriptor;
+    unsigned events{0};
+    events |= dfsEvent<InitVertexHook, Visitor, V, Graph>();
+    events |= dfsEvent<StartVertexHook, Visitor, V, Graph>();
+    events |= dfsEvent<DiscoverVertexHook, Visitor, V, Graph>();
+    events |= dfsEvent<FinishVertexHook, Visitor, V, Graph>();
+    events |= dfsEvent<ExamineEdgeHook, Visitor, E, Graph>();
+    events |= dfsEvent<TreeEdgeHook, Visitor, E, Graph>();
+    events |= dfsEvent<BackEdgeHook, Visitor, E, Graph>();
+    events |= dfsEvent<ForwardOrCrossEdgeHook, Visitor, E, Graph>();
+    events |= dfsEvent<FinishEdgeHook, Visitor, E, Graph>();
+    return events;
+}
 
-// The following pre-conditions are required:
-// - g is a directed acyclic graph
-template<typename Graph, typename Visitor>
-void dfs(const Graph &g, Visitor visitor)
+// Calls a hook for an event in Events, and otherwise does nothing.
+template<unsigned Events, DFSEvent Event, typename Hook>
+constexpr DFSControl dfsHook(Hook &&hook)
+{
+    if constexpr ((Events & Event) != 0) {
+        return dfsHook(std::forward<Hook>(hook));
+    } else {
+        return DFSControl::Continue;
+    }
+}
+
+// The colours of a search kept in a TraversalWorkspace.
+template<typename Graph>
+struct WorkspaceColours
+{
+    const Graph &g;
+    TraversalWorkspace<Graph> &workspace;
+
+    DFSColour colour(const typename Traits<Graph>::VertexDescriptor &v) const
+    {
+        return workspace.colour(getIndex(v, g));
+    }
+
+    void setColour(const typename Traits<Graph>::VertexDescriptor &v, DFSColour c)
+    {
+        workspace.setColour(getIndex(v, g), c);
+    }
+};
+
+// The colours of a search kept in a property map.
+template<typename ColourMap>
+struct MapColours
+{
+    ColourMap map;
+
+    template<typename V>
+    constexpr DFSColour colour(const V &v) const
+    {
+        return get(map, v);
+    }
+
+    template<typename V>
+    constexpr void setColour(const V &v, DFSColour c)
+    {
+        put(map, v, c);
+    }
+};
+
+// Returns false if the search was stopped.
+template<typename Graph, typename Visitor, typename Colours>
+constexpr bool dfsVisit(const Graph &g, Visitor &visitor, typename Traits<Graph>::VertexDescriptor u,
+              Colours &colours)
+{
+    constexpr auto events{dfsEvents<Visitor, Graph>()};
+
+    auto discovered{dfsHook<events, DiscoverVertex>([&] { return visitor.discoverVertex(u, g); })};
+    if (discovered == DFSControl::Stop) {
+        return false;
+    }
+    colours.setColour(u, DFSColour::Grey);
+    if (discovered != DFSControl::Prune) {
+        auto u_out_edges{outEdges(u, g)};
+        if constexpr ((events & EdgeEvents) == 0) {
+            // only the tree edges matter, and only to descend
+            for (const auto &e : u_out_edges) {
+                auto v{target(e, g)};
+                if (colours.colour(v) == DFSColour::White && !dfsVisit(g, visitor, v, colours)) {
+                    return false;
+                }
+            }
+        } else {
+            for (const auto &e : u_out_edges) {
+                auto v{target(e, g)};
+                auto examined{dfsHook<events, ExamineEdge>([&] { return visitor.examineEdge(e, g); })};
+                if (examined == DFSControl::Stop) {
+                    return false;
+                } else if (examined == DFSControl::Prune) {
+                    continue;
+                }
+                auto control{DFSControl::Continue};
+                auto colour{colours.colour(v)};
+                if (colour == DFSColour::White) {
+                    control = dfsHook<events, TreeEdge>([&] { return visitor.treeEdge(e, g); });
+                    if (control == DFSControl::Continue && !dfsVisit(g, visitor, v, colours)) {
+                        return false;
+                    }
+                } else if (colour == DFSColour::Grey) {
+                    control = dfsHook<events, BackEdge>([&] { return visitor.backEdge(e, g); });
+                } else if (colour == DFSColour::Black) {
+                    control = dfsHook<events, ForwardOrCrossEdge>([&] {
+                        return visitor.forwardOrCrossEdge(e, g);
+                    });
+                }
+                if (control == DFSControl::Stop
+                        || dfsHook<events, FinishEdge>([&] {
+                               return visitor.finishEdge(e, g);
+                           }) == DFSControl::Stop) {
+                    return false;
+                }
+            }
+        }
+    }
+    colours.setColour(u, DFSColour::Black);
+    return dfsHook<events, FinishVertex>([&] { return visitor.finishVertex(u, g); })
+           != DFSControl::Stop;
+}
+
+// The search of all of g, from each vertex still white in turn.
+template<typename Graph, typename Visitor, typename Colours>
+constexpr bool dfsAll(const Graph &g, Visitor &visitor, Colours &colours)
 {
-    auto colour{std::vector<detail::DFSColour>(numVertices(g))};
+    constexpr auto events{dfsEvents<Visitor, Graph>()};
+
     auto V{vertices(g)};
-    for (const auto &u : V) {
-        colour[getIndex(u, g)] = detail::DFSColour::White;
-        visitor.initVertex(u, g);
+    if constexpr ((events & InitVertex) != 0) {
+        for (const auto &u : V) {
+            if (dfsHook([&] { return visitor.initVertex(u, g); }) == DFSControl::Stop) {
+                return false;
+            }
+        }
     }
     for (const auto &u : V) {
-        if (colour[getIndex(u, g)] == detail::DFSColour::White) {
-            visitor.startVertex(u, g);
-            detail::dfsVisit(g, visitor, u, colour);
+        if (colours.colour(u) == DFSColour::White) {
+            auto control{dfsHook<events, StartVertex>([&] { return visitor.startVertex(u, g); })};
+            if (control == DFSControl::Stop) {
+                return false;
+            }
+            if (control == DFSControl::Continue && !dfsVisit(g, visitor, u, colours)) {
+                return false;
+            }
         }
     }
+    return true;
+}
+
+// The search of the vertices reachable from s.
+template<typename Graph, typename Visitor, typename Colours>
+constexpr bool dfsFrom(const Graph &g, typename Traits<Graph>::VertexDescriptor s, Visitor &visitor,
+             Colours &colours)
+{
+    constexpr auto events{dfsEvents<Visitor, Graph>()};
+
+    auto control{dfsHook<events, StartVertex>([&] { return visitor.startVertex(s, g); })};
+    if (control == DFSControl::Stop) {
+        return false;
+    }
+    return control == DFSControl::Prune || dfsVisit(g, visitor, s, colours);
+}
+
+} // namespace detail
+
+// Depth-first search of all of g, calling the hooks of visitor as it goes.
+// The visitor is taken by value, but the same copy is used for the whole
+// search. Returns false if a hook stopped the search, and true otherwise.
+// The colours are kept in workspace, which is reset first, so repeated
+// searches of the same graph do not allocate.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph, typename Visitor>
+bool dfs(const Graph &g, Visitor visitor, TraversalWorkspace<Graph> &workspace)
+{
+    workspace.reset(g);
+    auto colours{detail::WorkspaceColours<Graph>{g, workspace}};
+    return detail::dfsAll(g, visitor, colours);
+}
+
+template<typename Graph, typename Visitor>
+bool dfs(const Graph &g, Visitor visitor)
+{
+    auto workspace{TraversalWorkspace<Graph>(g)};
+    return dfs(g, visitor, workspace);
+}
+
+// Depth-first search of all of g as above, but with the colours kept in
+// colourMap, e.g. a PackedVertexMap<Graph, DFSColour, 2> of two bits per
+// vertex, so they can be read after the search. All vertices are coloured
+// white first.
+template<typename Graph, typename Visitor, typename ColourMap>
+requires ReadWritePropertyMap<ColourMap, typename Traits<Graph>::VertexDescriptor, DFSColour>
+constexpr bool dfs(const Graph &g, Visitor visitor, ColourMap colourMap)
+{
+    for (const auto &u : vertices(g)) {
+        put(colourMap, u, DFSColour::White);
+    }
+    auto colours{detail::MapColours<ColourMap>{colourMap}};
+    return detail::dfsAll(g, visitor, colours);
+}
+
+// Depth-first search of the vertices reachable from s only, calling
+// startVertex for s but initVertex for no vertex. With a workspace kept
+// between calls, a search takes time in the number of vertices and edges it
+// reaches, independent of the size of g.
+// The following pre-conditions are required:
+// - s is a valid vertex descriptor for g
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph, typename Visitor>
+bool dfs(const Graph &g, typename Traits<Graph>::VertexDescriptor s, Visitor visitor,
+         TraversalWorkspace<Graph> &workspace)
+{
+    workspace.reset(g);
+    auto colours{detail::WorkspaceColours<Graph>{g, workspace}};
+    return detail::dfsFrom(g, s, visitor, colours);
+}
+
+template<typename Graph, typename Visitor>
+bool dfs(const Graph &g, typename Traits<Graph>::VertexDescriptor s, Visitor visitor)
+{
+    auto workspace{TraversalWorkspace<Graph>(g)};
+    return dfs(g, s, visitor, workspace);
+}
+
+// Depth-first search from s as above, but with the colours kept in colourMap,
+// which is not reset: vertices that are not white are treated as already
+// visited, so several searches can share one map to visit each vertex once.
+// The following pre-conditions are required:
+// - s is a valid vertex descriptor for g, and white in colourMap
+template<typename Graph, typename Visitor, typename ColourMap>
+requires ReadWritePropertyMap<ColourMap, typename Traits<Graph>::VertexDescriptor, DFSColour>
+constexpr bool dfs(const Graph &g, typename Traits<Graph>::VertexDescriptor s, Visitor visitor,
+         ColourMap colourMap)
+{
+    auto colours{detail::MapColours<ColourMap>{colourMap}};
+    return detail::dfsFrom(g, s, visitor, colours);
 }
 
 } // namespace graph
@@ -0,0 +1,117 @@
+/**
+ * dijkstra.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Dijkstra's single-source shortest paths algorithm.
+ */
+#ifndef GRAPH_DIJKSTRA_HPP
+#define GRAPH_DIJKSTRA_HPP
+
+#include "concepts.hpp"
+#include "d_ary_heap.hpp"
+#include "property_map.hpp"
+#include "traits.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace graph {
+
+// The distance used for vertices that cannot be reached.
+template<typename Distance>
+constexpr Distance infiniteDistance()
+{
+    if constexpr (std::numeric_limits<Distance>::has_infinity) {
+        return std::numeric_limits<Distance>::infinity();
+    } else {
+        return std::numeric_limits<Distance>::max();
+    }
+}
+
+// The priority queue of dijkstra, kept between calls so that repeated
+// queries on the same graph do not allocate.
+template<typename Graph, typename Distance>
+struct DijkstraWorkspace
+{
+    IndexedDAryHeap<typename Traits<Graph>::VertexDescriptor, Distance> heap;
+};
+
+// Computes the shortest paths from s to all other vertices of g, using an
+// indexed 4-ary heap with decrease-key, so every vertex is in the heap at most
+// once. The weight of an edge e is get(weightMap, e). The distance of every
+// vertex v is written to distanceMap, infiniteDistance<Distance>() if v cannot
+// be reached, and its predecessor on a shortest path to predecessorMap, v
+// itself for s and for unreachable vertices.
+// The heap of workspace is reused, and is only grown if g has grown.
+// The following pre-conditions are required:
+// - s is a valid vertex descriptor for g
+// - all weights are non-negative
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph, typename WeightMap, typename DistanceMap, typename PredecessorMap>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+         && ReadablePropertyMap<WeightMap, typename Traits<Graph>::EdgeDescriptor>
+         && ReadWritePropertyMap<DistanceMap, typename Traits<Graph>::VertexDescriptor,
+                                 typename DistanceMap::Value>
+         && WritablePropertyMap<PredecessorMap, typename Traits<Graph>::VertexDescriptor,
+                                typename Traits<Graph>::VertexDescriptor>
+void dijkstra(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+              WeightMap weightMap, DistanceMap distanceMap, PredecessorMap predecessorMap,
+              DijkstraWorkspace<Graph, typename DistanceMap::Value> &workspace)
+{
+    using Distance = typename DistanceMap::Value;
+    auto &heap{workspace.heap};
+    heap.clear();
+    heap.reserve(numVertices(g));
+
+    for (const auto &v : vertices(g)) {
+        put(distanceMap, v, infiniteDistance<Distance>());
+        put(predecessorMap, v, v);
+    }
+    put(distanceMap, s, Distance{});
+    heap.push(getIndex(s, g), s, Distance{});
+
+    while (!heap.empty()) {
+        auto u{heap.top().value};
+        auto du{heap.top().priority};
+        heap.pop();
+        for (const auto &e : outEdges(u, g)) {
+            auto v{target(e, g)};
+            Distance dv = du + get(weightMap, e);
+            if (dv < get(distanceMap, v)) {
+                auto vi{getIndex(v, g)};
+                if (heap.contains(vi)) {
+                    heap.decrease(vi, dv);
+                } else {
+                    heap.push(vi, v, dv);
+                }
+                put(distanceMap, v, dv);
+                put(predecessorMap, v, u);
+            }
+        }
+    }
+}
+
+// As above, with a workspace allocated for this call only.
+template<typename Graph, typename WeightMap, typename DistanceMap, typename PredecessorMap>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+         && ReadablePropertyMap<WeightMap, typename Traits<Graph>::EdgeDescriptor>
+         && ReadWritePropertyMap<DistanceMap, typename Traits<Graph>::VertexDescriptor,
+                                 typename DistanceMap::Value>
+         && WritablePropertyMap<PredecessorMap, typename Traits<Graph>::VertexDescriptor,
+                                typename Traits<Graph>::VertexDescriptor>
+void dijkstra(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+              WeightMap weightMap, DistanceMap distanceMap, PredecessorMap predecessorMap)
+{
+    auto workspace{DijkstraWorkspace<Graph, typename DistanceMap::Value>{}};
+    dijkstra(g, s, weightMap, distanceMap, predecessorMap, workspace);
+}
+
+} // namespace graph
+
+#endif // GRAPH_DIJKSTRA_HPP
@@ -0,0 +1,212 @@
+/**
+ * dynamic_topological_sort.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * A topological order maintained under edge insertion using the algorithm of
+ * Pearce and Kelly, "A Dynamic Topological Sort Algorithm for Directed Acyclic
+ * Graphs", ACM JEA 11, 2006.
+ */
+#ifndef GRAPH_DYNAMIC_TOPOLOGICAL_SORT_HPP
+#define GRAPH_DYNAMIC_TOPOLOGICAL_SORT_HPP
+
+#include "concepts.hpp"
+#include "topological_sort.hpp"
+#include "traits.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace graph {
+namespace detail {
+
+// Forwarders, as the member functions of DynamicTopoOrder hide the free ones.
+template<typename Graph, typename... Args>
+auto graphAddVertex(Graph &g, Args &&...args)
+{
+    return addVertex(std::forward<Args>(args)..., g);
+}
+
+template<typename Graph, typename V, typename... Args>
+auto graphAddEdge(Graph &g, V u, V v, Args &&...args)
+{
+    return addEdge(u, v, std::forward<Args>(args)..., g);
+}
+
+} // namespace detail
+
+// Owns a directed acyclic graph and keeps a topological order of it up to date
+// while vertices and edges are added. An edge (u, v) whose endpoints are
+// already ordered costs O(1). Otherwise only the affected region, the vertices
+// between v and u in the order that are reachable from v or reach u, is
+// searched and reordered. Edges that would close a cycle are rejected.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g)), and
+//   a new vertex gets the next index
+template<typename Graph>
+requires BidirectionalGraph<Graph> && VertexListGraph<Graph> && MutableGraph<Graph>
+class DynamicTopoOrder
+{
+public:
+    using VertexDescriptor = typename Traits<Graph>::VertexDescriptor;
+    using EdgeDescriptor = typename Traits<Graph>::EdgeDescriptor;
+
+public:
+    DynamicTopoOrder() = default;
+
+    // Takes ownership of g and computes an initial order.
+    // Throws NotADagError if g is not acyclic.
+    explicit DynamicTopoOrder(Graph graph) : g(std::move(graph))
+    {
+        for (const auto &level : topoSortLevels(g, execution::Parallel{1})) {
+            for (const auto &v : level) {
+                ord.resize(std::max(ord.size(), getIndex(v, g) + 1));
+                ord[getIndex(v, g)] = vertexAt.size();
+                vertexAt.push_back(v);
+            }
+        }
+        mark.assign(vertexAt.size(), 0);
+    }
+
+public:
+    const Graph &graph() const
+    {
+        return g;
+    }
+
+    // The vertices of the graph in topological order.
+    const std::vector<VertexDescriptor> &order() const
+    {
+        return vertexAt;
+    }
+
+    // The position of v in order().
+    std::size_t position(VertexDescriptor v) const
+    {
+        return ord[getIndex(v, g)];
+    }
+
+public:
+    // Adds a vertex, which is placed last in the order.
+    template<typename... VertexPropArg>
+    VertexDescriptor addVertex(VertexPropArg &&...vp)
+    {
+        auto v{detail::graphAddVertex(g, std::forward<VertexPropArg>(vp)...)};
+        ord.push_back(vertexAt.size());
+        vertexAt.push_back(v);
+        mark.push_back(0);
+        return v;
+    }
+
+    // Adds the edge (u, v), with an optional edge property, and updates the
+    // order. Returns an empty optional, and leaves the graph unchanged, if the
+    // edge would create a cycle.
+    // The following pre-conditions are required:
+    // - the pre-conditions of addEdge on the underlying graph
+    template<typename... EdgePropArg>
+    std::optional<EdgeDescriptor> addEdge(VertexDescriptor u, VertexDescriptor v,
+                                          EdgePropArg &&...ep)
+    {
+        if (getIndex(u, g) == getIndex(v, g) || (position(u) > position(v) && !reorder(u, v))) {
+            return std::nullopt;
+        }
+        return detail::graphAddEdge(g, u, v, std::forward<EdgePropArg>(ep)...);
+    }
+
+private:
+    // Pearce-Kelly reordering for an edge (u, v) with position(u) > position(v).
+    // Returns false if v reaches u, in which case nothing is changed.
+    bool reorder(VertexDescriptor u, VertexDescriptor v)
+    {
+        auto lb{position(v)}, ub{position(u)};
+        if (++epoch == 0) {
+            std::fill(mark.begin(), mark.end(), 0);
+            epoch = 1;
+        }
+
+        // forward search from v among the vertices before u
+        deltaF.clear();
+        stack.assign(1, v);
+        mark[getIndex(v, g)] = epoch;
+        while (!stack.empty()) {
+            auto w{stack.back()};
+            stack.pop_back();
+            deltaF.push_back(w);
+            for (const auto &e : outEdges(w, g)) {
+                auto x{target(e, g)};
+                auto xi{getIndex(x, g)};
+                if (ord[xi] == ub) {
+                    return false;
+                }
+                if (mark[xi] != epoch && ord[xi] < ub) {
+                    mark[xi] = epoch;
+                    stack.push_back(x);
+                }
+            }
+        }
+
+        // backward search from u among the vertices after v
+        deltaB.clear();
+        stack.assign(1, u);
+        mark[getIndex(u, g)] = epoch;
+        while (!stack.empty()) {
+            auto w{stack.back()};
+            stack.pop_back();
+            deltaB.push_back(w);
+            for (const auto &e : inEdges(w, g)) {
+                auto x{source(e, g)};
+                auto xi{getIndex(x, g)};
+                if (mark[xi] != epoch && ord[xi] > lb) {
+                    mark[xi] = epoch;
+                    stack.push_back(x);
+                }
+            }
+        }
+
+        // Give the affected vertices their old positions, sorted, with all of
+        // deltaB before all of deltaF, each keeping its relative order.
+        auto byPosition = [this](const VertexDescriptor &a, const VertexDescriptor &b) {
+            return position(a) < position(b);
+        };
+        std::sort(deltaB.begin(), deltaB.end(), byPosition);
+        std::sort(deltaF.begin(), deltaF.end(), byPosition);
+        positions.clear();
+        for (const auto &w : deltaB) {
+            positions.push_back(position(w));
+        }
+        for (const auto &w : deltaF) {
+            positions.push_back(position(w));
+        }
+        std::sort(positions.begin(), positions.end());
+        auto p{positions.begin()};
+        for (const auto *delta : {&deltaB, &deltaF}) {
+            for (const auto &w : *delta) {
+                ord[getIndex(w, g)] = *p;
+                vertexAt[*p] = w;
+                ++p;
+            }
+        }
+        return true;
+    }
+
+private:
+    Graph g;
+    std::vector<std::size_t> ord;            // getIndex(v, g) -> position
+    std::vector<VertexDescriptor> vertexAt;  // position -> vertex
+    // scratch space reused between insertions
+    std::vector<unsigned> mark;
+    unsigned epoch = 0;
+    std::vector<VertexDescriptor> stack, deltaF, deltaB;
+    std::vector<std::size_t> positions;
+};
+
+} // namespace graph
+
+#endif // GRAPH_DYNAMIC_TOPOLOGICAL_SORT_HPP
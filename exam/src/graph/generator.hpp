@@ -0,0 +1,172 @@
+/**
+ * generator.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * A coroutine generator, used to turn traversals into lazy input ranges.
+ */
+#ifndef GRAPH_GENERATOR_HPP
+#define GRAPH_GENERATOR_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+namespace graph {
+
+// The result of a coroutine that produces a sequence of values of type T with
+// co_yield. A Generator is a move-only input range: the coroutine runs up to
+// its first co_yield when begin() is called and on to the next one each time
+// the iterator is incremented, so only the prefix of the sequence that is
+// actually read is ever computed.
+// An exception escaping the coroutine is rethrown from begin() or operator++.
+// The following pre-conditions are required:
+// - begin() is called at most once
+template<typename T>
+class Generator : public std::ranges::view_interface<Generator<T>>
+{
+public:
+    struct promise_type
+    {
+        const T *current = nullptr;
+        std::exception_ptr error;
+
+        Generator get_return_object()
+        {
+            return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        // The value lives in the coroutine, or is a temporary of the co_yield
+        // expression, until the coroutine is resumed.
+        std::suspend_always yield_value(const T &value) noexcept
+        {
+            current = std::addressof(value);
+            return {};
+        }
+
+        void return_void() noexcept { }
+
+        void unhandled_exception()
+        {
+            error = std::current_exception();
+        }
+
+        // Disallow co_await inside generators.
+        void await_transform() = delete;
+    };
+
+    class iterator
+    {
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+
+    public:
+        iterator() = default;
+
+        explicit iterator(std::coroutine_handle<promise_type> h) : h(h) { }
+
+        iterator(iterator &&) = default;
+        iterator &operator=(iterator &&) = default;
+
+    public:
+        const T &operator*() const
+        {
+            return *h.promise().current;
+        }
+
+        iterator &operator++()
+        {
+            resume(h);
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        friend bool operator==(const iterator &it, std::default_sentinel_t)
+        {
+            return !it.h || it.h.done();
+        }
+
+    private:
+        std::coroutine_handle<promise_type> h;
+    };
+
+public:
+    Generator() = default;
+
+    Generator(Generator &&other) noexcept : h(std::exchange(other.h, {})) { }
+
+    Generator &operator=(Generator &&other) noexcept
+    {
+        if (this != &other) {
+            if (h) {
+                h.destroy();
+            }
+            h = std::exchange(other.h, {});
+        }
+        return *this;
+    }
+
+    ~Generator()
+    {
+        if (h) {
+            h.destroy();
+        }
+    }
+
+public:
+    iterator begin()
+    {
+        if (h) {
+            resume(h);
+        }
+        return iterator(h);
+    }
+
+    std::default_sentinel_t end() const
+    {
+        return std::default_sentinel;
+    }
+
+private:
+    explicit Generator(std::coroutine_handle<promise_type> h) : h(h) { }
+
+    static void resume(std::coroutine_handle<promise_type> h)
+    {
+        h.resume();
+        if (h.promise().error) {
+            std::rethrow_exception(std::exchange(h.promise().error, nullptr));
+        }
+    }
+
+private:
+    std::coroutine_handle<promise_type> h;
+};
+
+} // namespace graph
+
+#endif // GRAPH_GENERATOR_HPP
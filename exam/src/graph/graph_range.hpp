@@ -0,0 +1,41 @@
+/**
+ * graph_range.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * The base of the vertex and edge ranges handed out by the graphs.
+ */
+#ifndef GRAPH_GRAPH_RANGE_HPP
+#define GRAPH_GRAPH_RANGE_HPP
+
+#include <concepts>
+#include <ranges>
+
+namespace graph {
+namespace detail {
+
+// The ranges returned by vertices, edges, outEdges and inEdges only refer to
+// the storage of their graph. Deriving from GraphRange makes such a range a
+// std::ranges::view, so it composes with std::views without being wrapped,
+// and a borrowed range, so its iterators stay valid after the range object
+// itself is gone, as long as the graph is not changed.
+template<typename Derived>
+struct GraphRange : std::ranges::view_interface<Derived> {};
+
+} // namespace detail
+} // namespace graph
+
+namespace std::ranges {
+
+template<typename R>
+requires std::derived_from<R, graph::detail::GraphRange<R>>
+inline constexpr bool enable_borrowed_range<R> = true;
+
+} // namespace std::ranges
+
+#endif // GRAPH_GRAPH_RANGE_HPP
@@ -0,0 +1,181 @@
+/**
+ * lazy_traversal.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Depth- and breadth-first traversals as lazy ranges of vertices.
+ */
+#ifndef GRAPH_LAZY_TRAVERSAL_HPP
+#define GRAPH_LAZY_TRAVERSAL_HPP
+
+#include "concepts.hpp"
+#include "generator.hpp"
+#include "traits.hpp"
+#include "traversal_workspace.hpp"
+
+#include <vector>
+
+// Where dfs and bfs push every vertex to a visitor, the traversals below are
+// pulled by the caller, one vertex per step, e.g. with a range-for loop or
+// through std::views. A traversal is suspended between steps, and only does
+// the work needed for the vertices read so far, so reading a prefix of the
+// order and dropping the range costs only that prefix.
+
+namespace graph {
+namespace detail {
+
+template<typename Graph>
+Generator<typename Traits<Graph>::VertexDescriptor>
+dfsOrder(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+         TraversalWorkspace<Graph> *shared, bool postorder)
+{
+    using OutEdgeIterator = typename Traits<Graph>::OutEdgeRange::iterator;
+    struct Frame
+    {
+        typename Traits<Graph>::VertexDescriptor v;
+        OutEdgeIterator it, last;
+    };
+
+    auto owned{TraversalWorkspace<Graph>{}};
+    auto &workspace{shared ? *shared : owned};
+    workspace.reset(g);
+    auto stack{std::vector<Frame>{}};
+    auto discover = [&](const auto &v) {
+        workspace.setColour(getIndex(v, g), DFSColour::Grey);
+        auto out{outEdges(v, g)};
+        stack.push_back(Frame{v, out.begin(), out.end()});
+    };
+
+    discover(s);
+    if (!postorder) {
+        co_yield s;
+    }
+    while (!stack.empty()) {
+        auto &top{stack.back()};
+        if (top.it != top.last) {
+            auto v{target(*top.it, g)};
+            ++top.it;
+            if (workspace.colour(getIndex(v, g)) == DFSColour::White) {
+                discover(v);
+                if (!postorder) {
+                    co_yield v;
+                }
+            }
+            continue;
+        }
+        auto v{top.v};
+        stack.pop_back();
+        workspace.setColour(getIndex(v, g), DFSColour::Black);
+        if (postorder) {
+            co_yield v;
+        }
+    }
+}
+
+template<typename Graph>
+Generator<typename Traits<Graph>::VertexDescriptor>
+bfsOrder(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+         TraversalWorkspace<Graph> *shared)
+{
+    auto owned{TraversalWorkspace<Graph>{}};
+    auto &workspace{shared ? *shared : owned};
+    workspace.reset(g);
+    auto &queue{workspace.queue()};
+    workspace.setColour(getIndex(s, g), DFSColour::Grey);
+    queue.push_back(s);
+    co_yield s;
+    for (std::size_t i = 0; i < queue.size(); ++i) {
+        auto u{queue[i]};
+        for (const auto &e : outEdges(u, g)) {
+            auto v{target(e, g)};
+            if (workspace.colour(getIndex(v, g)) == DFSColour::White) {
+                workspace.setColour(getIndex(v, g), DFSColour::Grey);
+                queue.push_back(v);
+                co_yield v;
+            }
+        }
+        workspace.setColour(getIndex(u, g), DFSColour::Black);
+    }
+}
+
+} // namespace detail
+
+// The vertices reachable from s in the order a depth-first search discovers
+// them, i.e. the order of discoverVertex in dfs(g, s, visitor).
+// The colours are kept in workspace, which is reset when the range is first
+// read, so a traversal costs only the vertices it reaches and never
+// allocates per vertex of g. Without a workspace, one is allocated for g.
+// The following pre-conditions are required:
+// - s is a valid vertex descriptor for g
+// - g, and workspace if given, outlive the range, and g is not modified
+//   while the range is in use
+// - workspace is not used by anything else while the range is in use
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph>
+requires IncidenceGraph<Graph>
+Generator<typename Traits<Graph>::VertexDescriptor>
+dfsPreorder(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+            TraversalWorkspace<Graph> &workspace)
+{
+    return detail::dfsOrder(g, s, &workspace, false);
+}
+
+template<typename Graph>
+requires IncidenceGraph<Graph>
+Generator<typename Traits<Graph>::VertexDescriptor>
+dfsPreorder(const Graph &g, typename Traits<Graph>::VertexDescriptor s)
+{
+    return detail::dfsOrder<Graph>(g, s, nullptr, false);
+}
+
+// The vertices reachable from s in the order a depth-first search finishes
+// them, i.e. the order of finishVertex in dfs(g, s, visitor). The first
+// vertex is only produced once the search has reached a dead end.
+// The pre-conditions are those of dfsPreorder.
+template<typename Graph>
+requires IncidenceGraph<Graph>
+Generator<typename Traits<Graph>::VertexDescriptor>
+dfsPostorder(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+             TraversalWorkspace<Graph> &workspace)
+{
+    return detail::dfsOrder(g, s, &workspace, true);
+}
+
+template<typename Graph>
+requires IncidenceGraph<Graph>
+Generator<typename Traits<Graph>::VertexDescriptor>
+dfsPostorder(const Graph &g, typename Traits<Graph>::VertexDescriptor s)
+{
+    return detail::dfsOrder<Graph>(g, s, nullptr, true);
+}
+
+// The vertices reachable from s in the order a breadth-first search discovers
+// them, i.e. the order of discoverVertex in bfs(g, s, visitor). A vertex is
+// produced as soon as it is discovered, before the vertices ahead of it in the
+// queue have been examined.
+// The pre-conditions are those of dfsPreorder.
+template<typename Graph>
+requires IncidenceGraph<Graph>
+Generator<typename Traits<Graph>::VertexDescriptor>
+bfsOrder(const Graph &g, typename Traits<Graph>::VertexDescriptor s,
+         TraversalWorkspace<Graph> &workspace)
+{
+    return detail::bfsOrder(g, s, &workspace);
+}
+
+template<typename Graph>
+requires IncidenceGraph<Graph>
+Generator<typename Traits<Graph>::VertexDescriptor>
+bfsOrder(const Graph &g, typename Traits<Graph>::VertexDescriptor s)
+{
+    return detail::bfsOrder<Graph>(g, s, nullptr);
+}
+
+} // namespace graph
+
+#endif // GRAPH_LAZY_TRAVERSAL_HPP
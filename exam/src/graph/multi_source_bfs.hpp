@@ -0,0 +1,213 @@
+/**
+ * multi_source_bfs.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Bit-parallel breadth-first search from many sources at once.
+ */
+#ifndef GRAPH_MULTI_SOURCE_BFS_HPP
+#define GRAPH_MULTI_SOURCE_BFS_HPP
+
+#include "concepts.hpp"
+#include "traits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace graph {
+
+// A set of up to Width sources of a multi-source search, one bit each.
+template<std::size_t Width>
+class SourceMask
+{
+    static_assert(Width > 0 && Width % 64 == 0, "the width must be a multiple of 64");
+    static constexpr std::size_t numWords = Width / 64;
+
+public:
+    static constexpr std::size_t width = Width;
+
+public:
+    bool test(std::size_t i) const
+    {
+        return (words[i / 64] >> (i % 64)) & 1;
+    }
+
+    void set(std::size_t i)
+    {
+        words[i / 64] |= std::uint64_t{1} << (i % 64);
+    }
+
+    bool any() const
+    {
+        std::uint64_t any{0};
+        for (auto w : words) {
+            any |= w;
+        }
+        return any != 0;
+    }
+
+    std::size_t count() const
+    {
+        std::size_t count{0};
+        for (auto w : words) {
+            count += static_cast<std::size_t>(__builtin_popcountll(w));
+        }
+        return count;
+    }
+
+    // Calls f(i) for every i in the set, in increasing order.
+    template<typename F>
+    void forEach(F &&f) const
+    {
+        for (std::size_t k = 0; k < numWords; ++k) {
+            for (auto w = words[k]; w != 0; w &= w - 1) {
+                f(k * 64 + static_cast<std::size_t>(__builtin_ctzll(w)));
+            }
+        }
+    }
+
+    SourceMask &operator|=(const SourceMask &other)
+    {
+        for (std::size_t k = 0; k < numWords; ++k) {
+            words[k] |= other.words[k];
+        }
+        return *this;
+    }
+
+    // The sources in this set but not in other.
+    SourceMask without(const SourceMask &other) const
+    {
+        auto result{SourceMask{}};
+        for (std::size_t k = 0; k < numWords; ++k) {
+            result.words[k] = words[k] & ~other.words[k];
+        }
+        return result;
+    }
+
+private:
+    std::array<std::uint64_t, numWords> words{};
+};
+
+// Breadth-first search from all of sources at once, with the
+// multi-source algorithm of Then et al., "The More the Merrier: Efficient
+// Multi-Source Graph Traversal", VLDB 2014. Every vertex keeps a mask of the
+// searches that have reached it and of those that reach it in the current
+// level, so the out-edges of a vertex are scanned once per level for all the
+// searches reaching it together, instead of once per search.
+// For every vertex v reached by any search, visitor(v, d, mask) is called
+// once per distance d, where mask holds the indices into sources of the
+// searches reaching v at distance d, i.e. at which v is at distance d from
+// that source. The vertices are reported in order of distance.
+// The following pre-conditions are required:
+// - sources.size() <= Width, and all sources are valid vertex descriptors
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<std::size_t Width = 64, typename Graph, typename Visitor>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+void multiSourceBfs(const Graph &g,
+                    const std::vector<typename Traits<Graph>::VertexDescriptor> &sources,
+                    Visitor &&visitor)
+{
+    using VertexDescriptor = typename Traits<Graph>::VertexDescriptor;
+    using Mask = SourceMask<Width>;
+
+    auto n{static_cast<std::size_t>(numVertices(g))};
+    auto seen{std::vector<Mask>(n)};
+    auto visit{std::vector<Mask>(n)};
+    auto visitNext{std::vector<Mask>(n)};
+    auto frontier{std::vector<VertexDescriptor>{}};
+    auto next{std::vector<VertexDescriptor>{}};
+
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        auto s{getIndex(sources[i], g)};
+        if (!visit[s].any()) {
+            frontier.push_back(sources[i]);
+        }
+        seen[s].set(i);
+        visit[s].set(i);
+    }
+    for (const auto &v : frontier) {
+        visitor(v, std::size_t{0}, visit[getIndex(v, g)]);
+    }
+
+    for (std::size_t level = 1; !frontier.empty(); ++level) {
+        next.clear();
+        for (const auto &u : frontier) {
+            const auto &reaching{visit[getIndex(u, g)]};
+            for (const auto &e : outEdges(u, g)) {
+                auto v{target(e, g)};
+                auto vi{getIndex(v, g)};
+                auto fresh{reaching.without(seen[vi])};
+                if (fresh.any()) {
+                    if (!visitNext[vi].any()) {
+                        next.push_back(v);
+                    }
+                    visitNext[vi] |= fresh;
+                }
+            }
+        }
+        for (const auto &u : frontier) {
+            visit[getIndex(u, g)] = Mask{};
+        }
+        for (const auto &v : next) {
+            auto vi{getIndex(v, g)};
+            seen[vi] |= visitNext[vi];
+            visit[vi] = visitNext[vi];
+            visitNext[vi] = Mask{};
+            visitor(v, level, visit[vi]);
+        }
+        std::swap(frontier, next);
+    }
+}
+
+// Distance statistics of a set of breadth-first searches, indexed like the
+// sources they were computed for.
+struct MultiSourceBfsStats
+{
+    // The number of vertices reached, the source included.
+    std::vector<std::size_t> reached;
+    // The largest distance to a reached vertex.
+    std::vector<std::size_t> eccentricity;
+    // The sum of the distances to the reached vertices.
+    std::vector<std::uint64_t> totalDistance;
+};
+
+// Computes the statistics of a breadth-first search from each of sources,
+// e.g. for closeness centrality (reached - 1) / totalDistance or eccentricity
+// estimates, with multiSourceBfs on batches of Width sources.
+// The following pre-conditions are required:
+// - all sources are valid vertex descriptors
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<std::size_t Width = 256, typename Graph>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+MultiSourceBfsStats multiSourceBfsStats(const Graph &g,
+                                        const std::vector<typename Traits<Graph>::VertexDescriptor> &sources)
+{
+    auto stats{MultiSourceBfsStats{}};
+    stats.reached.assign(sources.size(), 0);
+    stats.eccentricity.assign(sources.size(), 0);
+    stats.totalDistance.assign(sources.size(), 0);
+    auto batch{std::vector<typename Traits<Graph>::VertexDescriptor>{}};
+    for (std::size_t first = 0; first < sources.size(); first += Width) {
+        auto last{std::min(sources.size(), first + Width)};
+        batch.assign(sources.begin() + first, sources.begin() + last);
+        multiSourceBfs<Width>(g, batch, [&](const auto &, std::size_t d, const SourceMask<Width> &mask) {
+            mask.forEach([&](std::size_t i) {
+                ++stats.reached[first + i];
+                stats.eccentricity[first + i] = d;
+                stats.totalDistance[first + i] += d;
+            });
+        });
+    }
+    return stats;
+}
+
+} // namespace graph
+
+#endif // GRAPH_MULTI_SOURCE_BFS_HPP
@@ -0,0 +1,195 @@
+/**
+ * page_rank.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Parallel pull-based PageRank.
+ */
+#ifndef GRAPH_PAGE_RANK_HPP
+#define GRAPH_PAGE_RANK_HPP
+
+#include "concepts.hpp"
+#include "parallel.hpp"
+#include "traits.hpp"
+#include "vertex_index.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace graph {
+
+struct PageRankOptions
+{
+    // The probability of following an edge rather than teleporting.
+    double damping = 0.85;
+    // Iteration stops when the sum of the absolute rank changes is below this.
+    double tolerance = 1e-9;
+    std::size_t maxIterations = 100;
+    // The teleport distribution, indexed by getIndex. If empty, teleports go
+    // to all vertices uniformly; otherwise it is normalised to sum to 1.
+    std::vector<double> personalization;
+    execution::Parallel policy = execution::par;
+};
+
+struct PageRankResult
+{
+    // The rank of each vertex v at getIndex(v, g); the ranks sum to 1.
+    std::vector<double> rank;
+    std::size_t iterations = 0;
+    // The sum of the absolute rank changes in the last iteration.
+    double residual = 0;
+    bool converged = false;
+};
+
+namespace detail {
+
+// Per-thread partial sums, padded so threads do not share cache lines.
+struct alignas(64) PartialSum
+{
+    double value = 0;
+};
+
+inline double sumPartials(std::vector<PartialSum> &partials)
+{
+    double sum{0};
+    for (auto &p : partials) {
+        sum += p.value;
+        p.value = 0;
+    }
+    return sum;
+}
+
+// The rank computation on a compressed copy of the in-edges of g, where Index
+// is the smallest type holding all vertex indices, to save memory bandwidth.
+template<typename Index, typename Graph>
+PageRankResult pageRank(const Graph &g, const PageRankOptions &options)
+{
+    constexpr std::size_t grain{1024};
+
+    auto n{static_cast<std::size_t>(numVertices(g))};
+    auto pool{ThreadPool(options.policy)};
+    auto partials{std::vector<PartialSum>(pool.numThreads())};
+    auto result{PageRankResult{}};
+    if (n == 0) {
+        result.converged = true;
+        return result;
+    }
+
+    auto vertexOf{detail::indexedVertices(g)};
+
+    // in-edges as compressed sparse rows: the sources of the in-edges of v
+    // are inSource[inOffset[v]] through inSource[inOffset[v + 1] - 1]
+    auto inOffset{std::vector<std::size_t>(n + 1, 0)};
+    for (std::size_t v = 0; v < n; ++v) {
+        inOffset[v + 1] = inOffset[v] + inDegree(vertexOf[v], g);
+    }
+    auto inSource{std::vector<Index>(inOffset[n])};
+    auto invOutDegree{std::vector<double>(n)};
+    parallelChunks(pool, n, grain, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto v = first; v < last; ++v) {
+            auto k{inOffset[v]};
+            for (const auto &e : inEdges(vertexOf[v], g)) {
+                inSource[k++] = static_cast<Index>(getIndex(source(e, g), g));
+            }
+            auto d{outDegree(vertexOf[v], g)};
+            invOutDegree[v] = d == 0 ? 0.0 : 1.0 / static_cast<double>(d);
+        }
+    });
+
+    auto teleport{std::vector<double>(n, 1.0 / static_cast<double>(n))};
+    if (!options.personalization.empty()) {
+        if (options.personalization.size() != n) {
+            throw std::invalid_argument("PageRank personalization must have one entry per vertex.");
+        }
+        auto total{std::accumulate(options.personalization.begin(),
+                                   options.personalization.end(), 0.0)};
+        if (!(total > 0)) {
+            throw std::invalid_argument("PageRank personalization must have a positive sum.");
+        }
+        for (std::size_t v = 0; v < n; ++v) {
+            teleport[v] = options.personalization[v] / total;
+        }
+    }
+
+    const auto d{options.damping};
+    auto &rank{result.rank};
+    rank = teleport;
+    auto next{std::vector<double>(n)};
+    auto contrib{std::vector<double>(n)};
+
+    while (result.iterations < options.maxIterations) {
+        ++result.iterations;
+        // the contribution of u to each of its out-neighbours, and the rank
+        // held by vertices without out-edges, which is spread like teleports
+        parallelChunks(pool, n, grain, [&](std::size_t tid, std::size_t first, std::size_t last) {
+            double dangling{0};
+            for (auto u = first; u < last; ++u) {
+                contrib[u] = rank[u] * invOutDegree[u];
+                dangling += invOutDegree[u] == 0.0 ? rank[u] : 0.0;
+            }
+            partials[tid].value += dangling;
+        });
+        auto teleportMass{(1.0 - d) + d * sumPartials(partials)};
+
+        parallelChunks(pool, n, grain, [&](std::size_t tid, std::size_t first, std::size_t last) {
+            double change{0};
+            for (auto v = first; v < last; ++v) {
+                // four independent sums, so the gathers can be overlapped or
+                // vectorised without reassociating a single sum
+                double s0{0}, s1{0}, s2{0}, s3{0};
+                auto k{inOffset[v]}, end{inOffset[v + 1]};
+                for (; k + 4 <= end; k += 4) {
+                    s0 += contrib[inSource[k]];
+                    s1 += contrib[inSource[k + 1]];
+                    s2 += contrib[inSource[k + 2]];
+                    s3 += contrib[inSource[k + 3]];
+                }
+                for (; k < end; ++k) {
+                    s0 += contrib[inSource[k]];
+                }
+                next[v] = teleportMass * teleport[v] + d * ((s0 + s1) + (s2 + s3));
+                change += std::abs(next[v] - rank[v]);
+            }
+            partials[tid].value += change;
+        });
+        result.residual = sumPartials(partials);
+        rank.swap(next);
+        if (result.residual < options.tolerance) {
+            result.converged = true;
+            break;
+        }
+    }
+    return result;
+}
+
+} // namespace detail
+
+// Computes the PageRank of every vertex of g by power iteration. Each
+// iteration pulls the rank of every vertex from its in-edges, which are
+// first copied to a compact array of source indices, so the vertices can be
+// split between the threads of options.policy without any synchronisation.
+// The rank of vertices without out-edges is redistributed as teleports.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph>
+requires BidirectionalGraph<Graph> && VertexListGraph<Graph>
+PageRankResult pageRank(const Graph &g, const PageRankOptions &options = {})
+{
+    if (static_cast<std::size_t>(numVertices(g)) <= std::numeric_limits<std::uint32_t>::max()) {
+        return detail::pageRank<std::uint32_t>(g, options);
+    }
+    return detail::pageRank<std::size_t>(g, options);
+}
+
+} // namespace graph
+
+#endif // GRAPH_PAGE_RANK_HPP
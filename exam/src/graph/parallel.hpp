@@ -0,0 +1,320 @@
+/**
+ * parallel.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Execution policies and the thread pool shared by the parallel algorithms.
+ */
+#ifndef GRAPH_PARALLEL_HPP
+#define GRAPH_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace graph {
+namespace execution {
+
+// Tag to request the sequential version of an algorithm.
+struct Sequential {};
+
+// Tag to request the parallel version of an algorithm.
+// A numThreads of 0 means one thread per hardware thread.
+struct Parallel
+{
+    std::size_t numThreads = 0;
+};
+
+inline constexpr Sequential seq{};
+inline constexpr Parallel par{};
+
+} // namespace execution
+
+namespace detail {
+
+inline std::size_t numThreadsFor(execution::Parallel policy)
+{
+    if (policy.numThreads != 0) {
+        return policy.numThreads;
+    }
+    auto n{static_cast<std::size_t>(std::thread::hardware_concurrency())};
+    return n == 0 ? 1 : n;
+}
+
+} // namespace detail
+
+// A fixed set of threads that all execute the same job.
+// run(job) calls job(tid) once for each tid in [0, numThreads()), where the
+// calling thread itself takes tid 0, and returns when all calls have returned.
+// If a job throws, the first exception is rethrown from run().
+// The parallel algorithms that take a pool run on its threads instead of
+// starting their own, so repeated calls do not pay for starting threads.
+// The following pre-conditions are required:
+// - a pool runs one job at a time, so it is not used from several threads
+//   at once, nor from within a job running on it
+class ThreadPool
+{
+public:
+    explicit ThreadPool(std::size_t numThreads)
+    {
+        numThreads = std::max<std::size_t>(numThreads, 1);
+        workers.reserve(numThreads - 1);
+        for (std::size_t tid = 1; tid < numThreads; ++tid) {
+            workers.emplace_back([this, tid] { workerLoop(tid); });
+        }
+    }
+
+    explicit ThreadPool(execution::Parallel policy)
+        : ThreadPool(detail::numThreadsFor(policy)) { }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard lock{mutex};
+            stopping = true;
+        }
+        wakeCv.notify_all();
+        for (auto &t : workers) {
+            t.join();
+        }
+    }
+
+    std::size_t numThreads() const
+    {
+        return workers.size() + 1;
+    }
+
+    template<typename Job>
+    void run(Job &&job)
+    {
+        if (workers.empty()) {
+            job(std::size_t{0});
+            return;
+        }
+        {
+            std::lock_guard lock{mutex};
+            jobContext = const_cast<void *>(static_cast<const void *>(std::addressof(job)));
+            jobInvoke = [](void *ctx, std::size_t tid) {
+                (*static_cast<std::remove_reference_t<Job> *>(ctx))(tid);
+            };
+            pending = workers.size();
+            error = nullptr;
+            ++generation;
+        }
+        wakeCv.notify_all();
+        invoke(0);
+        std::unique_lock lock{mutex};
+        doneCv.wait(lock, [this] { return pending == 0; });
+        if (error) {
+            std::rethrow_exception(std::exchange(error, nullptr));
+        }
+    }
+
+private:
+    void invoke(std::size_t tid)
+    {
+        try {
+            jobInvoke(jobContext, tid);
+        } catch (...) {
+            std::lock_guard lock{mutex};
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    void workerLoop(std::size_t tid)
+    {
+        std::size_t seen{0};
+        for (;;) {
+            {
+                std::unique_lock lock{mutex};
+                wakeCv.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) {
+                    return;
+                }
+                seen = generation;
+            }
+            invoke(tid);
+            {
+                std::lock_guard lock{mutex};
+                if (--pending == 0) {
+                    doneCv.notify_one();
+                }
+            }
+        }
+    }
+
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wakeCv, doneCv;
+    void *jobContext = nullptr;
+    void (*jobInvoke)(void *, std::size_t) = nullptr;
+    std::size_t generation = 0;
+    std::size_t pending = 0;
+    bool stopping = false;
+    std::exception_ptr error;
+};
+
+namespace detail {
+
+// Splits [0, n) into chunks of at most grain indices and hands them out
+// dynamically to the threads of pool, calling f(tid, first, last) per chunk.
+template<typename F>
+void parallelChunks(ThreadPool &pool, std::size_t n, std::size_t grain, F &&f)
+{
+    if (n == 0) {
+        return;
+    }
+    grain = std::max<std::size_t>(grain, 1);
+    if (pool.numThreads() == 1 || n <= grain) {
+        for (std::size_t first = 0; first < n; first += grain) {
+            f(std::size_t{0}, first, std::min(first + grain, n));
+        }
+        return;
+    }
+    std::atomic<std::size_t> cursor{0};
+    pool.run([&](std::size_t tid) {
+        for (;;) {
+            auto first{cursor.fetch_add(grain, std::memory_order_relaxed)};
+            if (first >= n) {
+                return;
+            }
+            f(tid, first, std::min(first + grain, n));
+        }
+    });
+}
+
+// Concatenates the per-thread buffers in parts into out, copying in parallel.
+template<typename T>
+void parallelConcat(ThreadPool &pool, std::vector<std::vector<T>> &parts, std::vector<T> &out)
+{
+    auto offsets{std::vector<std::size_t>(parts.size() + 1, 0)};
+    for (std::size_t i = 0; i < parts.size(); ++i) {
+        offsets[i + 1] = offsets[i] + parts[i].size();
+    }
+    out.resize(offsets.back());
+    parallelChunks(pool, parts.size(), 1, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            std::copy(parts[i].begin(), parts[i].end(), out.begin() + offsets[i]);
+        }
+    });
+}
+
+// Runs process(tid, item, push) for every item in initial and for every item
+// handed to push(item) from within process, on all threads of pool.
+// Each thread keeps its own deque of items, taking the newest item of its own
+// deque first and stealing the oldest item of another thread when it runs dry.
+// Returns when all items have been processed.
+// The following pre-conditions are required:
+// - process does not throw
+template<typename Process>
+void workStealing(ThreadPool &pool, const std::vector<std::size_t> &initial, Process &&process)
+{
+    struct alignas(64) WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<std::size_t> items;
+    };
+
+    auto numThreads{pool.numThreads()};
+    auto queues{std::vector<WorkQueue>(numThreads)};
+    for (std::size_t i = 0; i < initial.size(); ++i) {
+        queues[i % numThreads].items.push_back(initial[i]);
+    }
+    // items waiting in the queues
+    std::atomic<std::size_t> queued{initial.size()};
+    // items queued or being processed; an item pushes its successors before
+    // it is itself counted as done, so zero means that no work can appear
+    std::atomic<std::size_t> inFlight{initial.size()};
+    // Idle threads sleep until work is queued or all work is done. A thread
+    // counts itself in sleepers before testing that under idleMutex, and a
+    // thread changing queued or inFlight tests sleepers afterwards and then
+    // notifies under idleMutex, so one of them always sees the other and no
+    // wake-up is lost between the test and the wait.
+    std::atomic<std::size_t> sleepers{0};
+    std::mutex idleMutex;
+    std::condition_variable idleCv;
+    auto wake = [&](bool all) {
+        if (sleepers.load() > 0) {
+            std::lock_guard lock{idleMutex};
+            if (all) {
+                idleCv.notify_all();
+            } else {
+                idleCv.notify_one();
+            }
+        }
+    };
+
+    pool.run([&](std::size_t tid) {
+        auto push = [&](std::size_t item) {
+            inFlight.fetch_add(1);
+            {
+                std::lock_guard lock{queues[tid].mutex};
+                queues[tid].items.push_back(item);
+                queued.fetch_add(1);
+            }
+            wake(false);
+        };
+        auto pop = [&](std::size_t &item) {
+            for (std::size_t i = 0; i < numThreads; ++i) {
+                // the newest item of the own queue, else the oldest of another
+                auto &queue{queues[(tid + i) % numThreads]};
+                std::lock_guard lock{queue.mutex};
+                if (!queue.items.empty()) {
+                    if (i == 0) {
+                        item = queue.items.back();
+                        queue.items.pop_back();
+                    } else {
+                        item = queue.items.front();
+                        queue.items.pop_front();
+                    }
+                    queued.fetch_sub(1);
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        std::size_t item;
+        for (;;) {
+            if (pop(item)) {
+                process(tid, item, push);
+                if (inFlight.fetch_sub(1) == 1) {
+                    wake(true);
+                }
+                continue;
+            }
+            std::unique_lock lock{idleMutex};
+            sleepers.fetch_add(1);
+            idleCv.wait(lock, [&] { return queued.load() > 0 || inFlight.load() == 0; });
+            sleepers.fetch_sub(1);
+            if (inFlight.load() == 0) {
+                return;
+            }
+        }
+    });
+}
+
+} // namespace detail
+} // namespace graph
+
+#endif // GRAPH_PARALLEL_HPP
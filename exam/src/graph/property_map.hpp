@@ -0,0 +1,335 @@
+/**
+ * property_map.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Property maps for passing vertex and edge data in and out of algorithms.
+ */
+#ifndef GRAPH_PROPERTY_MAP_HPP
+#define GRAPH_PROPERTY_MAP_HPP
+
+#include "traits.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// This file is based on the property maps of the BGL: a property map
+// associates a value with each key, a vertex or edge descriptor, which is
+// read with get(map, key) and written with put(map, key, value).
+
+namespace graph {
+
+// A map from which the value of key can be read with get(map, key).
+template<typename Map, typename Key>
+concept ReadablePropertyMap = requires(const Map &m, const Key &k) {
+    get(m, k);
+};
+
+// A map to which value can be written for key with put(map, key, value).
+// Maps are passed by value, so a map must write through to storage shared by
+// its copies, and put takes a const map.
+template<typename Map, typename Key, typename Value>
+concept WritablePropertyMap = requires(const Map &m, const Key &k, Value v) {
+    put(m, k, std::move(v));
+};
+
+// A map that can both be read and written, where get reads back a Value.
+template<typename Map, typename Key, typename Value>
+concept ReadWritePropertyMap = ReadablePropertyMap<Map, Key> && WritablePropertyMap<Map, Key, Value>
+        && requires(const Map &m, const Key &k) {
+            { get(m, k) } -> std::convertible_to<Value>;
+        };
+
+// A vertex property map over a random access sequence, e.g. a std::vector,
+// where the value of v is stored at position getIndex(v, g). Over a
+// std::array it needs no allocation, so it can be used in constant
+// expressions, e.g. as the colour map of dfs on a StaticGraph.
+template<typename Graph, typename RandomAccessIterator>
+struct IteratorVertexMap
+{
+    using Key = typename Traits<Graph>::VertexDescriptor;
+    using Value = std::iter_value_t<RandomAccessIterator>;
+    using Reference = std::iter_reference_t<RandomAccessIterator>;
+
+public:
+    constexpr IteratorVertexMap(RandomAccessIterator first, const Graph &g) : first(first), g(&g) { }
+
+    constexpr Reference operator[](const Key &v) const
+    {
+        return first[getIndex(v, *g)];
+    }
+
+    friend constexpr Reference get(const IteratorVertexMap &m, const Key &v)
+    {
+        return m[v];
+    }
+
+    friend constexpr void put(const IteratorVertexMap &m, const Key &v, Value value)
+    {
+        m[v] = std::move(value);
+    }
+
+private:
+    RandomAccessIterator first;
+    const Graph *g;
+};
+
+template<typename Graph, typename RandomAccessIterator>
+constexpr IteratorVertexMap<Graph, RandomAccessIterator>
+makeIteratorVertexMap(RandomAccessIterator first, const Graph &g)
+{
+    return IteratorVertexMap<Graph, RandomAccessIterator>(first, g);
+}
+
+// An edge property map reading the properties stored in a PropertyGraph,
+// i.e. get(m, e) is g[e].
+template<typename Graph>
+struct EdgePropMap
+{
+    using Key = typename Traits<Graph>::EdgeDescriptor;
+    using Value = typename Traits<Graph>::EdgeProp;
+    using Reference = const Value &;
+
+public:
+    explicit EdgePropMap(const Graph &g) : g(&g) { }
+
+    Reference operator[](const Key &e) const
+    {
+        return (*g)[e];
+    }
+
+    friend Reference get(const EdgePropMap &m, const Key &e)
+    {
+        return m[e];
+    }
+
+private:
+    const Graph *g;
+};
+
+template<typename Graph>
+EdgePropMap<Graph> makeEdgePropMap(const Graph &g)
+{
+    return EdgePropMap<Graph>(g);
+}
+
+// An edge property map reading the inline edge properties of an
+// AdjacencyList, i.e. get(m, e) is inlineProp(e, g). As the value is carried
+// by the descriptor, reading it does not touch the graph.
+template<typename Graph>
+struct InlineEdgePropMap
+{
+    using Key = typename Traits<Graph>::EdgeDescriptor;
+    using Value = typename Graph::InlineEdgeProp;
+    using Reference = Value;
+
+public:
+    explicit InlineEdgePropMap(const Graph &g) : g(&g) { }
+
+    Reference operator[](const Key &e) const
+    {
+        return inlineProp(e, *g);
+    }
+
+    friend Reference get(const InlineEdgePropMap &m, const Key &e)
+    {
+        return m[e];
+    }
+
+private:
+    const Graph *g;
+};
+
+template<typename Graph>
+InlineEdgePropMap<Graph> makeInlineEdgePropMap(const Graph &g)
+{
+    return InlineEdgePropMap<Graph>(g);
+}
+
+// A vertex property map owning a std::vector holding a value per vertex,
+// stored at position getIndex(v, g). Copies of the map share the vector, so
+// results written by an algorithm through its copy can be read afterwards.
+// For bool, or small enumerations, a PackedVertexMap takes less space.
+// The following pre-conditions are required:
+// - g has no more vertices than when the map was made
+template<typename Graph, typename T>
+struct VectorVertexMap
+{
+    using Key = typename Traits<Graph>::VertexDescriptor;
+    using Value = T;
+    using Reference = typename std::vector<T>::reference;
+
+public:
+    explicit VectorVertexMap(const Graph &g, const T &init = T{})
+        : data(std::make_shared<std::vector<T>>(numVertices(g), init)), g(&g) { }
+
+    Reference operator[](const Key &v) const
+    {
+        return (*data)[getIndex(v, *g)];
+    }
+
+    friend Reference get(const VectorVertexMap &m, const Key &v)
+    {
+        return m[v];
+    }
+
+    friend void put(const VectorVertexMap &m, const Key &v, Value value)
+    {
+        m[v] = std::move(value);
+    }
+
+    // The values, indexed by getIndex.
+    std::vector<T> &values() const
+    {
+        return *data;
+    }
+
+private:
+    std::shared_ptr<std::vector<T>> data;
+    const Graph *g;
+};
+
+template<typename T, typename Graph>
+VectorVertexMap<Graph, T> makeVectorVertexMap(const Graph &g, const T &init = T{})
+{
+    return VectorVertexMap<Graph, T>(g, init);
+}
+
+// A vertex property map packing the value of each vertex into Bits bits, e.g.
+// a single bit per vertex for bool, or two bits for the colours of a search.
+// Value must be bool, an unsigned integer or an enumeration, and every value
+// stored must be non-negative and fit in Bits bits, as the bits are read back
+// without sign extension. Copies of the map share the storage.
+// The following pre-conditions are required:
+// - g has no more vertices than when the map was made
+// - the map is not written concurrently, as neighbouring vertices share words
+template<typename Graph, typename T = bool, std::size_t Bits = 1>
+requires std::same_as<T, bool> || std::unsigned_integral<T> || std::is_enum_v<T>
+struct PackedVertexMap
+{
+    static_assert(Bits > 0 && 64 % Bits == 0, "a value must not straddle two words");
+
+    using Key = typename Traits<Graph>::VertexDescriptor;
+    using Value = T;
+    using Reference = T;
+
+public:
+    explicit PackedVertexMap(const Graph &g, T init = T{}) : g(&g)
+    {
+        auto word{std::uint64_t{0}};
+        for (std::size_t i = 0; i < perWord; ++i) {
+            word |= encode(init) << (i * Bits);
+        }
+        auto n{static_cast<std::size_t>(numVertices(g))};
+        data = std::make_shared<std::vector<std::uint64_t>>((n + perWord - 1) / perWord, word);
+    }
+
+    Reference operator[](const Key &v) const
+    {
+        auto i{getIndex(v, *g)};
+        return static_cast<T>(((*data)[i / perWord] >> (i % perWord * Bits)) & mask);
+    }
+
+    friend Reference get(const PackedVertexMap &m, const Key &v)
+    {
+        return m[v];
+    }
+
+    friend void put(const PackedVertexMap &m, const Key &v, Value value)
+    {
+        auto i{getIndex(v, *m.g)};
+        auto shift{i % perWord * Bits};
+        auto &word{(*m.data)[i / perWord]};
+        word = (word & ~(mask << shift)) | (encode(value) << shift);
+    }
+
+    // The number of bytes used for the values.
+    std::size_t bytes() const
+    {
+        return data->size() * sizeof(std::uint64_t);
+    }
+
+private:
+    static constexpr std::size_t perWord = 64 / Bits;
+    static constexpr std::uint64_t mask = Bits == 64 ? ~std::uint64_t{0}
+                                                     : (std::uint64_t{1} << Bits) - 1;
+
+    static std::uint64_t encode(T value)
+    {
+        return static_cast<std::uint64_t>(value) & mask;
+    }
+
+private:
+    std::shared_ptr<std::vector<std::uint64_t>> data;
+    const Graph *g;
+};
+
+template<typename T = bool, std::size_t Bits = 1, typename Graph>
+PackedVertexMap<Graph, T, Bits> makePackedVertexMap(const Graph &g, T init = T{})
+{
+    return PackedVertexMap<Graph, T, Bits>(g, init);
+}
+
+// A property map reading, and for a non-const Graph writing, one member of
+// the vertex or edge properties of a PropertyGraph, i.e. get(m, k) is
+// g[k].*member, where Key is the vertex or edge descriptor.
+template<typename Graph, typename Key, typename Prop, typename T>
+struct MemberPropertyMap
+{
+    using Value = T;
+    using Reference = std::conditional_t<std::is_const_v<Graph>, const T &, T &>;
+
+public:
+    MemberPropertyMap(Graph &g, T Prop::*member) : g(&g), member(member) { }
+
+    Reference operator[](const Key &k) const
+    {
+        return (*g)[k].*member;
+    }
+
+    friend Reference get(const MemberPropertyMap &m, const Key &k)
+    {
+        return m[k];
+    }
+
+    friend void put(const MemberPropertyMap &m, const Key &k, Value value)
+    requires (!std::is_const_v<Graph>)
+    {
+        m[k] = std::move(value);
+    }
+
+private:
+    Graph *g;
+    T Prop::*member;
+};
+
+template<typename Graph, typename Prop, typename T>
+MemberPropertyMap<Graph, typename Traits<std::remove_const_t<Graph>>::VertexDescriptor, Prop, T>
+makeVertexMemberMap(Graph &g, T Prop::*member)
+{
+    using Key = typename Traits<std::remove_const_t<Graph>>::VertexDescriptor;
+    return MemberPropertyMap<Graph, Key, Prop, T>(g, member);
+}
+
+template<typename Graph, typename Prop, typename T>
+MemberPropertyMap<Graph, typename Traits<std::remove_const_t<Graph>>::EdgeDescriptor, Prop, T>
+makeEdgeMemberMap(Graph &g, T Prop::*member)
+{
+    using Key = typename Traits<std::remove_const_t<Graph>>::EdgeDescriptor;
+    return MemberPropertyMap<Graph, Key, Prop, T>(g, member);
+}
+
+} // namespace graph
+
+#endif // GRAPH_PROPERTY_MAP_HPP
@@ -0,0 +1,258 @@
+/**
+ * reachability.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * An index answering reachability queries on a directed acyclic graph.
+ */
+#ifndef GRAPH_REACHABILITY_HPP
+#define GRAPH_REACHABILITY_HPP
+
+#include "concepts.hpp"
+#include "topological_sort.hpp"
+#include "traits.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace graph {
+
+// The scratch space of the searches of ReachabilityIndex::reaches, kept
+// between queries so that they do not allocate. A workspace must not be
+// shared between threads, but any number of threads can query the same
+// index, each with its own workspace.
+struct ReachabilityWorkspace
+{
+    std::vector<unsigned> mark;
+    unsigned epoch = 0;
+    std::vector<std::size_t> stack;
+};
+
+// Answers whether there is a path from u to v in a directed acyclic graph,
+// using the interval labels of Yildirim, Chaoji and Zaki, "GRAIL: Scalable
+// Reachability Index for Large Graphs", VLDB 2010.
+// Each of numLabels randomised depth-first traversals gives every vertex v an
+// interval [low, post], where post is its rank in postorder and low the least
+// rank among its descendants, so the interval of v contains that of every
+// vertex it reaches. A query is answered in O(numLabels) if the intervals, the
+// topological levels or the topological order rule the path out, or if v lies
+// in the DFS subtree of u in the first traversal. Otherwise a DFS from u
+// decides it, pruned by the same tests.
+// The index refers to the graph, which must outlive it and not be modified.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+class ReachabilityIndex
+{
+public:
+    using VertexDescriptor = typename Traits<Graph>::VertexDescriptor;
+
+public:
+    // Builds the index in O(numLabels * (V + E)) time and space.
+    // Throws NotADagError if g is not acyclic.
+    explicit ReachabilityIndex(const Graph &g, std::size_t numLabels = 3,
+                               std::uint_fast32_t seed = 1)
+        : g(&g), d(std::max<std::size_t>(numLabels, 1))
+    {
+        auto n{static_cast<std::size_t>(numVertices(g))};
+        level.resize(n);
+        order.resize(n);
+        std::size_t position{0}, l{0};
+        for (const auto &vs : topoSortLevels(g, execution::Parallel{1})) {
+            for (const auto &v : vs) {
+                level[getIndex(v, g)] = l;
+                order[getIndex(v, g)] = position++;
+            }
+            ++l;
+        }
+
+        offset.assign(n + 1, 0);
+        for (const auto &v : vertices(g)) {
+            offset[getIndex(v, g) + 1] = outDegree(v, g);
+        }
+        std::partial_sum(offset.begin(), offset.end(), offset.begin());
+        successor.resize(offset[n]);
+        for (const auto &v : vertices(g)) {
+            auto i{offset[getIndex(v, g)]};
+            for (const auto &e : outEdges(v, g)) {
+                successor[i++] = getIndex(target(e, g), g);
+            }
+        }
+
+        interval.resize(n * d);
+        preorder.resize(n);
+        subtreeEnd.resize(n);
+        auto gen{std::mt19937(seed)};
+        auto roots{std::vector<std::size_t>(n)};
+        std::iota(roots.begin(), roots.end(), std::size_t{0});
+        for (std::size_t t = 0; t < d; ++t) {
+            std::shuffle(roots.begin(), roots.end(), gen);
+            label(t, roots, t % 2 == 1);
+        }
+    }
+
+public:
+    std::size_t numLabels() const
+    {
+        return d;
+    }
+
+    // Returns whether v is reachable from u, u itself included.
+    // The following pre-conditions are required:
+    // - u and v are valid vertex descriptors for the indexed graph
+    bool reaches(VertexDescriptor u, VertexDescriptor v, ReachabilityWorkspace &workspace) const
+    {
+        auto ui{getIndex(u, *g)}, vi{getIndex(v, *g)};
+        if (ui == vi) {
+            return true;
+        }
+        if (!mayReach(ui, vi)) {
+            return false;
+        }
+        if (treeReaches(ui, vi)) {
+            return true;
+        }
+
+        auto &mark{workspace.mark};
+        auto &stack{workspace.stack};
+        if (mark.size() < level.size()) {
+            mark.assign(level.size(), 0);
+            workspace.epoch = 0;
+        }
+        if (++workspace.epoch == 0) {
+            std::fill(mark.begin(), mark.end(), 0);
+            workspace.epoch = 1;
+        }
+        auto epoch{workspace.epoch};
+        stack.assign(1, ui);
+        mark[ui] = epoch;
+        while (!stack.empty()) {
+            auto w{stack.back()};
+            stack.pop_back();
+            for (auto i = offset[w]; i < offset[w + 1]; ++i) {
+                auto x{successor[i]};
+                if (x == vi) {
+                    return true;
+                }
+                if (mark[x] == epoch || !mayReach(x, vi)) {
+                    continue;
+                }
+                if (treeReaches(x, vi)) {
+                    return true;
+                }
+                mark[x] = epoch;
+                stack.push_back(x);
+            }
+        }
+        return false;
+    }
+
+    // As above, with a workspace of its own, which is only allocated if the
+    // query needs a search.
+    bool reaches(VertexDescriptor u, VertexDescriptor v) const
+    {
+        auto workspace{ReachabilityWorkspace{}};
+        return reaches(u, v, workspace);
+    }
+
+private:
+    struct Interval
+    {
+        std::size_t low, post;
+    };
+
+    // false if the index rules out a path from u to v, for u != v
+    bool mayReach(std::size_t u, std::size_t v) const
+    {
+        if (level[u] >= level[v] || order[u] > order[v]) {
+            return false;
+        }
+        for (std::size_t t = 0; t < d; ++t) {
+            const auto &iu{interval[u * d + t]}, &iv{interval[v * d + t]};
+            if (iv.low < iu.low || iv.post > iu.post) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // true if v is in the subtree of u in the first traversal
+    bool treeReaches(std::size_t u, std::size_t v) const
+    {
+        return preorder[u] <= preorder[v] && preorder[v] < subtreeEnd[u];
+    }
+
+    // A depth-first traversal from the roots in the given order, writing the
+    // intervals of traversal t and, for t = 0, the subtree ranges.
+    void label(std::size_t t, const std::vector<std::size_t> &roots, bool reversed)
+    {
+        struct Frame
+        {
+            std::size_t v, next;
+        };
+
+        auto n{level.size()};
+        auto visited{std::vector<bool>(n, false)};
+        auto stack{std::vector<Frame>{}};
+        std::size_t post{0}, pre{0};
+        auto childAt = [&](std::size_t v, std::size_t k) {
+            return successor[reversed ? offset[v + 1] - 1 - k : offset[v] + k];
+        };
+        auto open = [&](std::size_t v) {
+            visited[v] = true;
+            if (t == 0) {
+                preorder[v] = pre++;
+            }
+            stack.push_back(Frame{v, 0});
+        };
+
+        for (auto r : roots) {
+            if (visited[r]) {
+                continue;
+            }
+            open(r);
+            while (!stack.empty()) {
+                auto &top{stack.back()};
+                auto v{top.v};
+                if (top.next < offset[v + 1] - offset[v]) {
+                    auto w{childAt(v, top.next++)};
+                    if (!visited[w]) {
+                        open(w);
+                    }
+                    continue;
+                }
+                stack.pop_back();
+                // acyclic, so every successor is finished by now
+                auto low{post};
+                for (auto i = offset[v]; i < offset[v + 1]; ++i) {
+                    low = std::min(low, interval[successor[i] * d + t].low);
+                }
+                interval[v * d + t] = Interval{low, post++};
+                if (t == 0) {
+                    subtreeEnd[v] = pre;
+                }
+            }
+        }
+    }
+
+private:
+    const Graph *g;
+    std::size_t d;
+    std::vector<std::size_t> level, order;      // topological level and position
+    std::vector<std::size_t> offset, successor; // the out-edges as compressed rows
+    std::vector<Interval> interval;             // d intervals per vertex
+    std::vector<std::size_t> preorder, subtreeEnd;
+};
+
+} // namespace graph
+
+#endif // GRAPH_REACHABILITY_HPP
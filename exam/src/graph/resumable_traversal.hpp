@@ -0,0 +1,286 @@
+/**
+ * resumable_traversal.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Depth-first search and topological sorting in bounded slices of work.
+ */
+#ifndef GRAPH_RESUMABLE_TRAVERSAL_HPP
+#define GRAPH_RESUMABLE_TRAVERSAL_HPP
+
+#include "concepts.hpp"
+#include "depth_first_search.hpp"
+#include "topological_sort.hpp"
+#include "traits.hpp"
+#include "traversal_workspace.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+// The work a single call to advance() may do. A step is one edge examined, or
+// one vertex passed to initVertex, checked as a possible root, or finished.
+// Limits left at their defaults are unbounded.
+// The clock is only read every clockInterval steps, so a slice may overrun
+// its time limit by that many steps.
+struct TraversalBudget
+{
+    static constexpr std::size_t clockInterval = 64;
+
+    std::size_t steps = std::numeric_limits<std::size_t>::max();
+    std::chrono::microseconds time = std::chrono::microseconds::max();
+};
+
+// A depth-first search that runs in slices: each call to advance() continues
+// where the previous one returned, until the budget of the call is spent or
+// the search is over. Between calls, the explicit stack and the colours are
+// kept in the object, so a search of a large graph can be spread over many
+// short calls, e.g. on threads that must return quickly.
+// The hooks of visitor are called exactly as by dfs, including the handling
+// of hooks returning DFSControl, so any visitor of dfs can be used.
+// The following pre-conditions are required:
+// - g outlives the search and is not modified while it is in progress
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph, typename Visitor = DFSNullVisitor>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+class ResumableDFS
+{
+public:
+    using VertexDescriptor = typename Traits<Graph>::VertexDescriptor;
+
+public:
+    // A search of all of g, as dfs(g, visitor).
+    explicit ResumableDFS(const Graph &g, Visitor visitor = Visitor{})
+        : g(&g), vis(std::move(visitor)), workspace(g), verts(vertices(g)),
+          cursor(verts.begin()), phase(cursor == verts.end() ? Phase::Roots : Phase::Init)
+    {
+        workspace.reset(g);
+    }
+
+    // A search of the vertices reachable from s, as dfs(g, s, visitor).
+    ResumableDFS(const Graph &g, VertexDescriptor s, Visitor visitor = Visitor{})
+        : g(&g), vis(std::move(visitor)), workspace(g), verts(vertices(g)),
+          cursor(verts.end()), root(s), phase(Phase::Roots)
+    {
+        workspace.reset(g);
+    }
+
+public:
+    // Continues the search for at most the given budget. Returns true if the
+    // search is over, either completed or stopped by a hook.
+    bool advance(TraversalBudget budget = {})
+    {
+        auto deadline{std::optional<std::chrono::steady_clock::time_point>{}};
+        if (budget.time != std::chrono::microseconds::max()) {
+            deadline = std::chrono::steady_clock::now() + budget.time;
+        }
+        for (std::size_t step = 0; phase != Phase::Done; ++step) {
+            if (step == budget.steps) {
+                break;
+            }
+            if (deadline && step % TraversalBudget::clockInterval == 0 && step != 0
+                    && std::chrono::steady_clock::now() >= *deadline) {
+                break;
+            }
+            if (!doStep()) {
+                phase = Phase::Done;
+                wasStopped = true;
+            }
+        }
+        return phase == Phase::Done;
+    }
+
+    bool done() const
+    {
+        return phase == Phase::Done;
+    }
+
+    // Whether a hook returned DFSControl::Stop.
+    bool stopped() const
+    {
+        return wasStopped;
+    }
+
+    // The number of edges examined so far.
+    std::size_t edgesExamined() const
+    {
+        return numEdgesExamined;
+    }
+
+    const Visitor &visitor() const
+    {
+        return vis;
+    }
+
+private:
+    using VertexRange = typename Traits<Graph>::VertexRange;
+    using VertexIterator = decltype(std::declval<VertexRange &>().begin());
+    using OutEdgeIterator = typename Traits<Graph>::OutEdgeRange::iterator;
+    using Colour = detail::DFSColour;
+
+    enum struct Phase {
+        Init, Roots, Search, Done
+    };
+
+    struct Frame
+    {
+        VertexDescriptor v;
+        // while a child is above the frame on the stack, *it is the tree
+        // edge to it, which is finished when the search comes back up
+        OutEdgeIterator it, last;
+    };
+
+    template<typename Hook>
+    static DFSControl hook(Hook &&h)
+    {
+        return detail::dfsHook(std::forward<Hook>(h));
+    }
+
+    // Does one step of the search. Returns false if a hook stopped it.
+    bool doStep()
+    {
+        switch (phase) {
+        case Phase::Init:
+            if (hook([&] { return vis.initVertex(*cursor++, *g); }) == DFSControl::Stop) {
+                return false;
+            }
+            if (cursor == verts.end()) {
+                cursor = verts.begin();
+                phase = Phase::Roots;
+            }
+            return true;
+        case Phase::Roots:
+            return nextRoot();
+        case Phase::Search:
+            return searchStep();
+        case Phase::Done:
+            break;
+        }
+        return true;
+    }
+
+    // Starts a search from the next white root, if any.
+    bool nextRoot()
+    {
+        if (!root) {
+            if (cursor == verts.end()) {
+                phase = Phase::Done;
+                return true;
+            }
+            auto v{*cursor++};
+            if (workspace.colour(getIndex(v, *g)) != Colour::White) {
+                return true;
+            }
+            root = v;
+        }
+        auto u{*std::exchange(root, std::nullopt)};
+        auto control{hook([&] { return vis.startVertex(u, *g); })};
+        if (control == DFSControl::Stop) {
+            return false;
+        }
+        if (control == DFSControl::Continue) {
+            phase = Phase::Search;
+            return discover(u);
+        }
+        return true;
+    }
+
+    bool discover(const VertexDescriptor &u)
+    {
+        auto discovered{hook([&] { return vis.discoverVertex(u, *g); })};
+        if (discovered == DFSControl::Stop) {
+            return false;
+        }
+        workspace.setColour(getIndex(u, *g), Colour::Grey);
+        auto out{outEdges(u, *g)};
+        if (discovered == DFSControl::Prune) {
+            stack.push_back(Frame{u, out.end(), out.end()});
+        } else {
+            stack.push_back(Frame{u, out.begin(), out.end()});
+        }
+        return true;
+    }
+
+    // Finishes the top vertex once its edges are done, and otherwise handles
+    // its next out-edge.
+    bool searchStep()
+    {
+        auto &top{stack.back()};
+        if (top.it == top.last) {
+            auto u{top.v};
+            stack.pop_back();
+            workspace.setColour(getIndex(u, *g), Colour::Black);
+            if (hook([&] { return vis.finishVertex(u, *g); }) == DFSControl::Stop) {
+                return false;
+            }
+            if (stack.empty()) {
+                phase = Phase::Roots;
+                return true;
+            }
+            auto e{*stack.back().it++};
+            return hook([&] { return vis.finishEdge(e, *g); }) != DFSControl::Stop;
+        }
+
+        auto e{*top.it};
+        ++numEdgesExamined;
+        auto examined{hook([&] { return vis.examineEdge(e, *g); })};
+        if (examined != DFSControl::Continue) {
+            ++top.it;
+            return examined != DFSControl::Stop;
+        }
+        auto v{target(e, *g)};
+        auto control{DFSControl::Continue};
+        auto colour{workspace.colour(getIndex(v, *g))};
+        if (colour == Colour::White) {
+            control = hook([&] { return vis.treeEdge(e, *g); });
+            if (control == DFSControl::Continue) {
+                return discover(v);
+            }
+        } else if (colour == Colour::Grey) {
+            control = hook([&] { return vis.backEdge(e, *g); });
+        } else {
+            control = hook([&] { return vis.forwardOrCrossEdge(e, *g); });
+        }
+        ++top.it;
+        return control != DFSControl::Stop
+               && hook([&] { return vis.finishEdge(e, *g); }) != DFSControl::Stop;
+    }
+
+private:
+    const Graph *g;
+    Visitor vis;
+    TraversalWorkspace<Graph> workspace;
+    VertexRange verts;
+    VertexIterator cursor;
+    std::optional<VertexDescriptor> root;
+    std::vector<Frame> stack;
+    Phase phase;
+    bool wasStopped = false;
+    std::size_t numEdgesExamined = 0;
+};
+
+// A topological sort that runs in slices, writing the vertices to oIter in
+// the same order as topoSort(g, oIter) once the search is done.
+// The pre-conditions are those of ResumableDFS and topoSort.
+template<typename Graph, typename OutputIterator>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+ResumableDFS<Graph, detail::TopoVisitor<OutputIterator>>
+resumableTopoSort(const Graph &g, OutputIterator oIter)
+{
+    return ResumableDFS<Graph, detail::TopoVisitor<OutputIterator>>(
+            g, detail::TopoVisitor<OutputIterator>{oIter});
+}
+
+} // namespace graph
+
+#endif // GRAPH_RESUMABLE_TRAVERSAL_HPP
@@ -0,0 +1,196 @@
+/**
+ * static_graph.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * A bidirectional graph fixed at compile time, usable in constant expressions.
+ */
+#ifndef GRAPH_STATIC_GRAPH_HPP
+#define GRAPH_STATIC_GRAPH_HPP
+
+#include "graph_range.hpp"
+#include "tags.hpp"
+#include "traits.hpp"
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace graph {
+
+// A directed graph with N vertices and the M edges given on construction,
+// stored as compressed out- and in-edge arrays in std::arrays. All operations
+// are constexpr, so a StaticGraph can be a constexpr variable, and dfs and
+// topoSort can run on it at compile time when given a colour map over a
+// std::array, as their workspace would allocate, e.g.
+//
+//     constexpr auto g{makeStaticGraph<3>({{0, 1}, {1, 2}})};
+//     constexpr auto order{[] {
+//         auto out{std::array<std::size_t, 3>{}};
+//         auto colours{std::array<DFSColour, 3>{}};
+//         topoSort(g, out.begin(), makeIteratorVertexMap(colours.begin(), g));
+//         return out;
+//     }()};
+//
+// The out-edges of a vertex keep the order in which they were given, and
+// edges(g) lists the edges grouped by source.
+template<std::size_t N, std::size_t M>
+class StaticGraph
+{
+public: // Graph
+    using DirectedCategory = tags::Bidirectional;
+    using VertexDescriptor = std::size_t;
+
+    struct EdgeDescriptor
+    {
+        std::size_t src = 0, tar = 0;
+        // the position of the edge in edges(g)
+        std::size_t idx = 0;
+
+        friend constexpr bool operator==(const EdgeDescriptor &a, const EdgeDescriptor &b)
+        {
+            return a.idx == b.idx;
+        }
+    };
+
+public: // ranges
+    // A contiguous range of vertices or edges stored in the graph.
+    template<typename T>
+    struct Range : detail::GraphRange<Range<T>>
+    {
+        using iterator = const T *;
+
+        constexpr Range() = default;
+        constexpr Range(const T *first, const T *last) : first(first), last(last) { }
+
+        constexpr iterator begin() const { return first; }
+        constexpr iterator end() const { return last; }
+        constexpr std::size_t size() const { return last - first; }
+
+        const T *first = nullptr, *last = nullptr;
+    };
+
+    using VertexRange = Range<VertexDescriptor>;
+    using EdgeRange = Range<EdgeDescriptor>;
+    using OutEdgeRange = Range<EdgeDescriptor>;
+    using InEdgeRange = Range<EdgeDescriptor>;
+
+public:
+    // Throws std::out_of_range, which fails constant evaluation, if an edge
+    // has an endpoint that is not in [0, N).
+    constexpr explicit StaticGraph(const std::array<std::pair<std::size_t, std::size_t>, M> &edgeList)
+    {
+        for (std::size_t v = 0; v < N; ++v) {
+            vertexIds[v] = v;
+        }
+        for (const auto &[u, v] : edgeList) {
+            if (u >= N || v >= N) {
+                throw std::out_of_range("StaticGraph: edge endpoint out of range.");
+            }
+            ++outStart[u + 1];
+            ++inStart[v + 1];
+        }
+        for (std::size_t v = 0; v < N; ++v) {
+            outStart[v + 1] += outStart[v];
+            inStart[v + 1] += inStart[v];
+        }
+        // stable counting sorts, by source and then by target
+        auto outNext{outStart};
+        for (const auto &[u, v] : edgeList) {
+            auto i{outNext[u]++};
+            outList[i] = EdgeDescriptor{u, v, i};
+        }
+        auto inNext{inStart};
+        for (const auto &e : outList) {
+            inList[inNext[e.tar]++] = e;
+        }
+    }
+
+public: // Graph
+    friend constexpr VertexDescriptor source(const EdgeDescriptor &e, const StaticGraph &)
+    {
+        return e.src;
+    }
+
+    friend constexpr VertexDescriptor target(const EdgeDescriptor &e, const StaticGraph &)
+    {
+        return e.tar;
+    }
+
+public: // VertexListGraph
+    friend constexpr std::size_t numVertices(const StaticGraph &)
+    {
+        return N;
+    }
+
+    friend constexpr VertexRange vertices(const StaticGraph &g)
+    {
+        return VertexRange{g.vertexIds.data(), g.vertexIds.data() + N};
+    }
+
+public: // EdgeListGraph
+    friend constexpr std::size_t numEdges(const StaticGraph &)
+    {
+        return M;
+    }
+
+    friend constexpr EdgeRange edges(const StaticGraph &g)
+    {
+        return EdgeRange{g.outList.data(), g.outList.data() + M};
+    }
+
+public: // Other
+    friend constexpr std::size_t getIndex(VertexDescriptor v, const StaticGraph &)
+    {
+        return v;
+    }
+
+public: // IncidenceGraph
+    friend constexpr OutEdgeRange outEdges(VertexDescriptor v, const StaticGraph &g)
+    {
+        return OutEdgeRange{g.outList.data() + g.outStart[v], g.outList.data() + g.outStart[v + 1]};
+    }
+
+    friend constexpr std::size_t outDegree(VertexDescriptor v, const StaticGraph &g)
+    {
+        return g.outStart[v + 1] - g.outStart[v];
+    }
+
+public: // BidirectionalGraph
+    friend constexpr InEdgeRange inEdges(VertexDescriptor v, const StaticGraph &g)
+    {
+        return InEdgeRange{g.inList.data() + g.inStart[v], g.inList.data() + g.inStart[v + 1]};
+    }
+
+    friend constexpr std::size_t inDegree(VertexDescriptor v, const StaticGraph &g)
+    {
+        return g.inStart[v + 1] - g.inStart[v];
+    }
+
+private:
+    std::array<VertexDescriptor, N> vertexIds{};
+    std::array<std::size_t, N + 1> outStart{}, inStart{};
+    std::array<EdgeDescriptor, M> outList{}, inList{};
+};
+
+// Makes a StaticGraph with N vertices from a list of edges, deducing the
+// number of edges, e.g. makeStaticGraph<3>({{0, 1}, {1, 2}}).
+template<std::size_t N, std::size_t M>
+constexpr StaticGraph<N, M> makeStaticGraph(const std::pair<std::size_t, std::size_t> (&edgeList)[M])
+{
+    auto list{std::array<std::pair<std::size_t, std::size_t>, M>{}};
+    for (std::size_t i = 0; i < M; ++i) {
+        list[i] = edgeList[i];
+    }
+    return StaticGraph<N, M>(list);
+}
+
+} // namespace graph
+
+#endif // GRAPH_STATIC_GRAPH_HPP
@@ -0,0 +1,316 @@
+/**
+ * strong_components.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Strongly connected components and the condensation of a graph.
+ */
+#ifndef GRAPH_STRONG_COMPONENTS_HPP
+#define GRAPH_STRONG_COMPONENTS_HPP
+
+#include "adjacency_list.hpp"
+#include "concepts.hpp"
+#include "parallel.hpp"
+#include "property_map.hpp"
+#include "tags.hpp"
+#include "traits.hpp"
+#include "vertex_index.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+// Computes the strongly connected components of g with the iterative
+// variant of Tarjan's algorithm by Pearce, "A space-efficient algorithm for
+// finding strongly connected components", IPL 116(1), 2016, which needs a
+// single index per vertex and no recursion.
+// The component of each vertex v is written as put(componentMap, v, c), where
+// the components are numbered from 0 in reverse topological order, i.e. every
+// edge between two components goes from a higher to a lower number.
+// Returns the number of components.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph, typename ComponentMap>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+std::size_t stronglyConnectedComponents(const Graph &g, ComponentMap componentMap)
+{
+    using OutEdgeIterator = typename Traits<Graph>::OutEdgeRange::iterator;
+    struct Frame
+    {
+        std::size_t v;
+        OutEdgeIterator it, last;
+    };
+
+    auto vertexOf{detail::indexedVertices(g)};
+    auto n{vertexOf.size()};
+    // rindex[v] is 0 for unvisited vertices, the DFS index (or the lowest
+    // index reachable) while v is open, and n - 1 - component when done.
+    auto rindex{std::vector<std::size_t>(n, 0)};
+    auto root{std::vector<bool>(n)};
+    auto done{std::vector<std::size_t>{}};
+    auto callStack{std::vector<Frame>{}};
+    std::size_t index{1};
+    auto c{n - 1};
+
+    auto beginVisiting = [&](std::size_t v) {
+        auto out{outEdges(vertexOf[v], g)};
+        callStack.push_back(Frame{v, out.begin(), out.end()});
+        root[v] = true;
+        rindex[v] = index++;
+    };
+    auto finishEdge = [&](std::size_t v, std::size_t w) {
+        if (rindex[w] < rindex[v]) {
+            rindex[v] = rindex[w];
+            root[v] = false;
+        }
+    };
+
+    for (std::size_t s = 0; s < n; ++s) {
+        if (rindex[s] != 0) {
+            continue;
+        }
+        beginVisiting(s);
+        while (!callStack.empty()) {
+            auto &top{callStack.back()};
+            if (top.it != top.last) {
+                auto w{getIndex(target(*top.it, g), g)};
+                if (rindex[w] == 0) {
+                    beginVisiting(w);
+                } else {
+                    finishEdge(top.v, w);
+                    ++top.it;
+                }
+                continue;
+            }
+            auto v{top.v};
+            callStack.pop_back();
+            if (root[v]) {
+                --index;
+                while (!done.empty() && rindex[v] <= rindex[done.back()]) {
+                    rindex[done.back()] = c;
+                    done.pop_back();
+                    --index;
+                }
+                rindex[v] = c--;
+            } else {
+                done.push_back(v);
+            }
+            if (!callStack.empty()) {
+                finishEdge(callStack.back().v, v);
+                ++callStack.back().it;
+            }
+        }
+    }
+
+    for (std::size_t v = 0; v < n; ++v) {
+        put(componentMap, vertexOf[v], n - 1 - rindex[v]);
+    }
+    return n - 1 - c;
+}
+
+// Computes the strongly connected components of g in parallel with the
+// forward-backward algorithm of Fleischer, Hendrickson and Pinar: the vertices
+// both reachable from and reaching a pivot form its component, and the
+// vertices only reachable, only reaching, or neither, form three independent
+// subproblems, which are processed as tasks on the threads of pool.
+// Vertices without in- or out-neighbours in their subproblem are first
+// trimmed off as singleton components.
+// The component of each vertex v is written as put(componentMap, v, c), where
+// the components are numbered from 0 in no particular order.
+// Returns the number of components.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+// - componentMap can be written concurrently for different vertices
+template<typename Graph, typename ComponentMap>
+requires BidirectionalGraph<Graph> && VertexListGraph<Graph>
+std::size_t stronglyConnectedComponents(const Graph &g, ComponentMap componentMap,
+                                        ThreadPool &pool)
+{
+    constexpr auto finished{std::numeric_limits<std::size_t>::max()};
+
+    auto vertexOf{detail::indexedVertices(g)};
+    auto n{vertexOf.size()};
+    // the subproblem each vertex belongs to, or finished
+    auto label{std::vector<std::atomic<std::size_t>>(n)};
+    for (auto &l : label) {
+        l.store(0, std::memory_order_relaxed);
+    }
+    std::atomic<std::size_t> nextLabel{1};
+    std::atomic<std::size_t> numComponents{0};
+
+    auto subproblems{std::deque<std::vector<std::size_t>>(1)};
+    std::mutex subproblemsMutex;
+    subproblems.front().resize(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        subproblems.front()[v] = v;
+    }
+    auto subproblemLabels{std::deque<std::size_t>{0}};
+
+    auto has = [&](std::size_t v, std::size_t l) {
+        return label[v].load(std::memory_order_relaxed) == l;
+    };
+    auto assign = [&](std::size_t v, std::size_t comp) {
+        label[v].store(finished, std::memory_order_relaxed);
+        put(componentMap, vertexOf[v], comp);
+    };
+
+    auto solve = [&](std::size_t, std::size_t task, auto &&push) {
+        std::vector<std::size_t> members;
+        std::size_t l;
+        {
+            std::lock_guard lock{subproblemsMutex};
+            members = std::move(subproblems[task]);
+            l = subproblemLabels[task];
+        }
+
+        // trim vertices that cannot be on a cycle within the subproblem
+        auto kept{std::size_t{0}};
+        for (auto v : members) {
+            bool hasOut{false}, hasIn{false};
+            for (const auto &e : outEdges(vertexOf[v], g)) {
+                if (has(getIndex(target(e, g), g), l)) {
+                    hasOut = true;
+                    break;
+                }
+            }
+            for (const auto &e : inEdges(vertexOf[v], g)) {
+                if (hasOut && has(getIndex(source(e, g), g), l)) {
+                    hasIn = true;
+                    break;
+                }
+            }
+            if (hasOut && hasIn) {
+                members[kept++] = v;
+            } else {
+                assign(v, numComponents.fetch_add(1, std::memory_order_relaxed));
+            }
+        }
+        members.resize(kept);
+        if (members.empty()) {
+            return;
+        }
+
+        auto fw{nextLabel.fetch_add(2, std::memory_order_relaxed)};
+        auto bw{fw + 1};
+        auto pivot{members.front()};
+        std::vector<std::size_t> queue{pivot};
+        label[pivot].store(fw, std::memory_order_relaxed);
+        for (std::size_t i = 0; i < queue.size(); ++i) {
+            for (const auto &e : outEdges(vertexOf[queue[i]], g)) {
+                auto w{getIndex(target(e, g), g)};
+                if (has(w, l)) {
+                    label[w].store(fw, std::memory_order_relaxed);
+                    queue.push_back(w);
+                }
+            }
+        }
+
+        auto comp{numComponents.fetch_add(1, std::memory_order_relaxed)};
+        queue.assign(1, pivot);
+        assign(pivot, comp);
+        for (std::size_t i = 0; i < queue.size(); ++i) {
+            for (const auto &e : inEdges(vertexOf[queue[i]], g)) {
+                auto w{getIndex(source(e, g), g)};
+                if (has(w, fw)) {
+                    assign(w, comp);
+                    queue.push_back(w);
+                } else if (has(w, l)) {
+                    label[w].store(bw, std::memory_order_relaxed);
+                    queue.push_back(w);
+                }
+            }
+        }
+
+        std::vector<std::size_t> parts[3];
+        std::size_t partLabels[3]{fw, bw, l};
+        for (auto v : members) {
+            auto lv{label[v].load(std::memory_order_relaxed)};
+            for (int p = 0; p < 3; ++p) {
+                if (lv == partLabels[p]) {
+                    parts[p].push_back(v);
+                }
+            }
+        }
+        for (int p = 0; p < 3; ++p) {
+            if (parts[p].empty()) {
+                continue;
+            }
+            std::size_t id;
+            {
+                std::lock_guard lock{subproblemsMutex};
+                id = subproblems.size();
+                subproblems.push_back(std::move(parts[p]));
+                subproblemLabels.push_back(partLabels[p]);
+            }
+            push(id);
+        }
+    };
+
+    detail::workStealing(pool, std::vector<std::size_t>{0}, solve);
+    return numComponents.load();
+}
+
+// As above, on a pool with the threads of the policy.
+template<typename Graph, typename ComponentMap>
+requires BidirectionalGraph<Graph> && VertexListGraph<Graph>
+std::size_t stronglyConnectedComponents(const Graph &g, ComponentMap componentMap,
+                                        execution::Parallel policy)
+{
+    auto pool{ThreadPool(policy)};
+    return stronglyConnectedComponents(g, componentMap, pool);
+}
+
+// Builds the condensation of g: a vertex per strongly connected component,
+// holding the descriptors of the vertices of that component, and an edge
+// between two components if g has an edge between their vertices.
+// The result is acyclic, so it can be sorted topologically and scheduled.
+// The following pre-conditions are required:
+// - componentMap holds a component numbering of g with numComponents
+//   components, as written by stronglyConnectedComponents
+template<typename Graph, typename ComponentMap>
+requires EdgeListGraph<Graph> && VertexListGraph<Graph>
+AdjacencyList<tags::Bidirectional, std::vector<typename Traits<Graph>::VertexDescriptor>>
+condensation(const Graph &g, const ComponentMap &componentMap, std::size_t numComponents)
+{
+    using VertexDescriptor = typename Traits<Graph>::VertexDescriptor;
+    using Condensation = AdjacencyList<tags::Bidirectional, std::vector<VertexDescriptor>>;
+
+    auto members{std::vector<std::vector<VertexDescriptor>>(numComponents)};
+    for (const auto &v : vertices(g)) {
+        members[get(componentMap, v)].push_back(v);
+    }
+    auto c{Condensation{}};
+    for (auto &m : members) {
+        addVertex(std::move(m), c);
+    }
+
+    auto arcs{std::vector<std::pair<std::size_t, std::size_t>>{}};
+    for (const auto &e : edges(g)) {
+        std::size_t cu = get(componentMap, source(e, g));
+        std::size_t cv = get(componentMap, target(e, g));
+        if (cu != cv) {
+            arcs.emplace_back(cu, cv);
+        }
+    }
+    std::sort(arcs.begin(), arcs.end());
+    arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+    for (auto [cu, cv] : arcs) {
+        addEdge(cu, cv, c);
+    }
+    return c;
+}
+
+} // namespace graph
+
+#endif // GRAPH_STRONG_COMPONENTS_HPP
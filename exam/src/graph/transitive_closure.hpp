@@ -0,0 +1,290 @@
+/**
+ * transitive_closure.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * The transitive closure and transitive reduction of a directed acyclic graph.
+ */
+#ifndef GRAPH_TRANSITIVE_CLOSURE_HPP
+#define GRAPH_TRANSITIVE_CLOSURE_HPP
+
+#include "concepts.hpp"
+#include "parallel.hpp"
+#include "properties.hpp"
+#include "topological_sort.hpp"
+#include "traits.hpp"
+#include "vertex_index.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Both are computed from reachability sets held as bit rows, one per vertex,
+// where the columns are the topological positions of the vertices. Walking
+// the vertices in reverse topological order, the row of a vertex is the union
+// of the rows of its successors, a word at a time, and every successor is
+// later than the vertex, so only the columns after it are touched.
+
+namespace graph {
+namespace detail {
+
+// The out-edges of a DAG by topological position: the vertex at position p
+// has the successors succ[offset[p]] through succ[offset[p + 1] - 1], sorted
+// by position, where rank[s] is the place of the edge in outEdges of the
+// vertex. The positions of level l are levelStart[l] to levelStart[l + 1].
+template<typename Graph>
+struct TopoRows
+{
+    std::vector<typename Traits<Graph>::VertexDescriptor> vertexAt;
+    std::vector<std::size_t> position; // getIndex(v, g) -> position
+    std::vector<std::size_t> levelStart;
+    std::vector<std::size_t> offset, succ, rank;
+};
+
+template<typename Graph>
+TopoRows<Graph> topoRows(const Graph &g, ThreadPool &pool, execution::Parallel policy)
+{
+    auto rows{TopoRows<Graph>{}};
+    auto n{static_cast<std::size_t>(numVertices(g))};
+    rows.position.resize(n);
+    rows.levelStart.push_back(0);
+    for (auto &level : topoSortLevels(g, policy)) {
+        for (const auto &v : level) {
+            rows.position[getIndex(v, g)] = rows.vertexAt.size();
+            rows.vertexAt.push_back(v);
+        }
+        rows.levelStart.push_back(rows.vertexAt.size());
+    }
+
+    rows.offset.assign(n + 1, 0);
+    for (std::size_t p = 0; p < n; ++p) {
+        rows.offset[p + 1] = rows.offset[p] + outDegree(rows.vertexAt[p], g);
+    }
+    rows.succ.resize(rows.offset[n]);
+    rows.rank.resize(rows.offset[n]);
+    parallelChunks(pool, n, 256, [&](std::size_t, std::size_t first, std::size_t last) {
+        auto row{std::vector<std::pair<std::size_t, std::size_t>>{}};
+        for (auto p = first; p < last; ++p) {
+            row.clear();
+            for (const auto &e : outEdges(rows.vertexAt[p], g)) {
+                row.emplace_back(rows.position[getIndex(target(e, g), g)], row.size());
+            }
+            std::sort(row.begin(), row.end());
+            for (std::size_t i = 0; i < row.size(); ++i) {
+                rows.succ[rows.offset[p] + i] = row[i].first;
+                rows.rank[rows.offset[p] + i] = row[i].second;
+            }
+        }
+    });
+    return rows;
+}
+
+// Computes the bit rows restricted to the columns [c0, c1) for the positions
+// before c1, all later rows being empty in those columns, into bits with
+// words words per row. If redundant is given, redundant[s] is set for every
+// edge slot s with a target in [c0, c1) that is reachable through another
+// successor, or that repeats the previous slot.
+template<typename Graph>
+void closureBlock(ThreadPool &pool, const TopoRows<Graph> &rows, std::size_t c0, std::size_t c1,
+                  std::vector<std::uint64_t> &bits, std::size_t words, std::vector<char> *redundant)
+{
+    bits.assign(c1 * words, 0);
+    for (auto l = rows.levelStart.size() - 1; l-- > 0;) {
+        auto first{rows.levelStart[l]}, last{std::min(rows.levelStart[l + 1], c1)};
+        if (first >= last) {
+            continue;
+        }
+        parallelChunks(pool, last - first, 64, [&](std::size_t, std::size_t i0, std::size_t i1) {
+            for (auto p = first + i0; p < first + i1; ++p) {
+                auto row{bits.data() + p * words};
+                auto b{rows.offset[p]}, e{rows.offset[p + 1]};
+                for (auto s = b; s < e; ++s) {
+                    auto q{rows.succ[s]};
+                    if (q >= c1 || (s > b && rows.succ[s - 1] == q)) {
+                        continue;
+                    }
+                    // the row of q has no columns at or before q
+                    auto w0{q + 1 > c0 ? (q + 1 - c0) / 64 : 0};
+                    auto from{bits.data() + q * words};
+                    for (auto w = w0; w < words; ++w) {
+                        row[w] |= from[w];
+                    }
+                }
+                for (auto s = b; s < e; ++s) {
+                    auto q{rows.succ[s]};
+                    if (q < c0 || q >= c1) {
+                        continue;
+                    }
+                    auto word{(q - c0) / 64};
+                    auto mask{std::uint64_t{1} << ((q - c0) % 64)};
+                    if (redundant && ((row[word] & mask) || (s > b && rows.succ[s - 1] == q))) {
+                        (*redundant)[s] = 1;
+                    }
+                }
+                for (auto s = b; s < e; ++s) {
+                    auto q{rows.succ[s]};
+                    if (q >= c0 && q < c1) {
+                        row[(q - c0) / 64] |= std::uint64_t{1} << ((q - c0) % 64);
+                    }
+                }
+            }
+        });
+    }
+}
+
+// Which properties transitiveReduction copies, NoProp meaning there are none.
+template<typename Graph>
+concept HasVertexProps = MutablePropertyGraph<Graph>
+                      && !std::same_as<typename Traits<Graph>::VertexProp, NoProp>;
+
+template<typename Graph>
+concept HasEdgeProps = MutablePropertyGraph<Graph>
+                    && !std::same_as<typename Traits<Graph>::EdgeProp, NoProp>;
+
+template<typename Graph>
+concept HasInlineEdgeProps = requires(const Graph &cg, Graph &g,
+                                      typename Traits<Graph>::EdgeDescriptor e) {
+    setInlineProp(e, inlineProp(e, cg), g);
+};
+
+} // namespace detail
+
+// The transitive closure of a DAG as a bit matrix of n * n bits, answering
+// whether there is a path of one or more edges from u to v in O(1).
+class TransitiveClosure
+{
+public:
+    TransitiveClosure() = default;
+
+    TransitiveClosure(std::vector<std::size_t> position, std::vector<std::uint64_t> bits)
+        : position(std::move(position)), bits(std::move(bits)),
+          words((this->position.size() + 63) / 64) { }
+
+public:
+    std::size_t size() const
+    {
+        return position.size();
+    }
+
+    // The following pre-conditions are required:
+    // - u and v are in [0, size()), as vertex indices given by getIndex
+    bool reaches(std::size_t u, std::size_t v) const
+    {
+        auto p{position[u]}, q{position[v]};
+        return (bits[p * words + q / 64] >> (q % 64)) & 1;
+    }
+
+    // The number of vertices reachable from u by a path of one or more edges.
+    std::size_t numReachable(std::size_t u) const
+    {
+        std::size_t count{0};
+        auto row{bits.data() + position[u] * words};
+        for (std::size_t w = 0; w < words; ++w) {
+            count += static_cast<std::size_t>(__builtin_popcountll(row[w]));
+        }
+        return count;
+    }
+
+private:
+    std::vector<std::size_t> position; // vertex index -> row and column
+    std::vector<std::uint64_t> bits;
+    std::size_t words = 0;
+};
+
+// Computes the transitive closure of g, in reverse topological order, with
+// the vertices of a level done in parallel. Takes O(V^2 / 8) bytes and
+// O(E * V / 64) word operations.
+// Throws NotADagError if g is not acyclic.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+TransitiveClosure transitiveClosure(const Graph &g, execution::Parallel policy = execution::par)
+{
+    auto pool{ThreadPool(policy)};
+    auto rows{detail::topoRows(g, pool, policy)};
+    auto n{rows.vertexAt.size()};
+    auto bits{std::vector<std::uint64_t>{}};
+    detail::closureBlock(pool, rows, 0, n, bits, (n + 63) / 64, nullptr);
+    return TransitiveClosure(std::move(rows.position), std::move(bits));
+}
+
+// Returns the transitive reduction of g: a graph of the same type with the
+// same vertices, in the same order and with the same properties, and only
+// those edges (u, v) of g for which there is no other path from u to v.
+// The kept edges keep their properties and are added vertex by vertex, in
+// the order of outEdges, and of parallel edges only the first is kept.
+// The reachability rows are built for blocks of columns at a time, so at most
+// about memoryBudget bytes of bit rows are held at once, with more passes
+// over the edges as the budget gets smaller compared to V^2 / 8.
+// Throws NotADagError if g is not acyclic.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g)), and
+//   a new vertex gets the next index
+template<typename Graph>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph> && MutableGraph<Graph>
+         && std::default_initializable<Graph>
+Graph transitiveReduction(const Graph &g, execution::Parallel policy = execution::par,
+                          std::size_t memoryBudget = std::size_t{1} << 28)
+{
+    auto pool{ThreadPool(policy)};
+    auto rows{detail::topoRows(g, pool, policy)};
+    auto n{rows.vertexAt.size()};
+
+    auto redundant{std::vector<char>(rows.succ.size(), 0)};
+    auto blockBits{std::max<std::size_t>(memoryBudget * 8 / std::max<std::size_t>(n, 1) / 64, 1) * 64};
+    auto bits{std::vector<std::uint64_t>{}};
+    for (std::size_t c0 = 0; c0 < n; c0 += blockBits) {
+        auto c1{std::min(n, c0 + blockBits)};
+        detail::closureBlock(pool, rows, c0, c1, bits, (c1 - c0 + 63) / 64, &redundant);
+    }
+    // back from sorted slots to the order of outEdges
+    auto keep{std::vector<char>(rows.succ.size())};
+    for (std::size_t p = 0; p < n; ++p) {
+        for (auto s = rows.offset[p]; s < rows.offset[p + 1]; ++s) {
+            keep[rows.offset[p] + rows.rank[s]] = !redundant[s];
+        }
+    }
+
+    auto r{Graph{}};
+    auto vertexOf{detail::indexedVertices(g)};
+    auto copyOf{std::vector<typename Traits<Graph>::VertexDescriptor>{}};
+    copyOf.reserve(n);
+    for (const auto &v : vertexOf) {
+        if constexpr (detail::HasVertexProps<Graph>) {
+            copyOf.push_back(addVertex(typename Traits<Graph>::VertexProp(g[v]), r));
+        } else {
+            copyOf.push_back(addVertex(r));
+        }
+    }
+    for (std::size_t u = 0; u < n; ++u) {
+        auto k{rows.offset[rows.position[u]]};
+        for (const auto &e : outEdges(vertexOf[u], g)) {
+            if (!keep[k++]) {
+                continue;
+            }
+            auto ru{copyOf[u]}, rv{copyOf[getIndex(target(e, g), g)]};
+            if constexpr (detail::HasEdgeProps<Graph> && detail::HasInlineEdgeProps<Graph>) {
+                addEdge(ru, rv, typename Traits<Graph>::EdgeProp(g[e]), inlineProp(e, g), r);
+            } else if constexpr (detail::HasEdgeProps<Graph>) {
+                addEdge(ru, rv, typename Traits<Graph>::EdgeProp(g[e]), r);
+            } else if constexpr (detail::HasInlineEdgeProps<Graph>) {
+                addEdge(ru, rv, inlineProp(e, g), r);
+            } else {
+                addEdge(ru, rv, r);
+            }
+        }
+    }
+    return r;
+}
+
+} // namespace graph
+
+#endif // GRAPH_TRANSITIVE_CLOSURE_HPP
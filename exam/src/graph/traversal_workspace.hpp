@@ -0,0 +1,105 @@
+/**
+ * traversal_workspace.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Reusable state of graph traversals, cleared in constant time.
+ */
+#ifndef GRAPH_TRAVERSAL_WORKSPACE_HPP
+#define GRAPH_TRAVERSAL_WORKSPACE_HPP
+
+#include "traits.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace graph {
+namespace detail {
+
+enum struct DFSColour {
+	White, Grey, Black
+};
+
+} // namespace detail
+
+// The colours of a search: white until discovered, grey while being explored,
+// and black when finished.
+using DFSColour = detail::DFSColour;
+
+// The colour of every vertex during a traversal, together with a queue that
+// the traversal may use, kept between traversals of the same graph.
+// Each entry is stamped with the traversal that last coloured it, and entries
+// with an older stamp read as white, so starting a new traversal with reset()
+// takes O(1) instead of recolouring all vertices. A traversal thus only pays
+// for the vertices it reaches.
+// A workspace must not be used by two traversals at the same time.
+template<typename Graph>
+class TraversalWorkspace
+{
+public:
+    using VertexDescriptor = typename Traits<Graph>::VertexDescriptor;
+    using Colour = detail::DFSColour;
+
+public:
+    TraversalWorkspace() = default;
+
+    explicit TraversalWorkspace(const Graph &g) : slots(numVertices(g)) { }
+
+public:
+    std::size_t size() const
+    {
+        return slots.size();
+    }
+
+    // Starts a new traversal of g, in which every vertex is white, growing
+    // the workspace if g has grown.
+    void reset(const Graph &g)
+    {
+        if (slots.size() < static_cast<std::size_t>(numVertices(g))) {
+            slots.resize(numVertices(g));
+        }
+        if (++epoch == 0) {
+            // the stamps wrapped around, so older ones could read as current
+            std::fill(slots.begin(), slots.end(), Slot{});
+            epoch = 1;
+        }
+        buffer.clear();
+    }
+
+    Colour colour(std::size_t index) const
+    {
+        return slots[index].epoch == epoch ? slots[index].colour : Colour::White;
+    }
+
+    void setColour(std::size_t index, Colour c)
+    {
+        slots[index] = Slot{epoch, c};
+    }
+
+    // Scratch space for the vertices of the traversal, e.g. its queue.
+    std::vector<VertexDescriptor> &queue()
+    {
+        return buffer;
+    }
+
+private:
+    struct Slot
+    {
+        unsigned epoch = 0;
+        Colour colour = Colour::White;
+    };
+
+    std::vector<Slot> slots;
+    unsigned epoch = 0;
+    std::vector<VertexDescriptor> buffer;
+};
+
+} // namespace graph
+
+#endif // GRAPH_TRAVERSAL_WORKSPACE_HPP
@@ -0,0 +1,285 @@
+/**
+ * triangles.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Triangle counting and local clustering coefficients by intersecting sorted
+ * neighbour lists.
+ */
+#ifndef GRAPH_TRIANGLES_HPP
+#define GRAPH_TRIANGLES_HPP
+
+#include "concepts.hpp"
+#include "parallel.hpp"
+#include "traits.hpp"
+#include "vertex_index.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace graph {
+namespace detail {
+
+// Neighbour lists in compressed sparse rows: the neighbours of u are
+// target[offset[u]] through target[offset[u + 1] - 1], sorted increasingly.
+struct SortedAdjacency
+{
+    std::vector<std::size_t> offset;
+    std::vector<std::uint32_t> target;
+
+    std::size_t degree(std::size_t u) const
+    {
+        return offset[u + 1] - offset[u];
+    }
+
+    const std::uint32_t *begin(std::size_t u) const
+    {
+        return target.data() + offset[u];
+    }
+
+    const std::uint32_t *end(std::size_t u) const
+    {
+        return target.data() + offset[u + 1];
+    }
+};
+
+// The simple undirected graph underlying g: every edge in both directions,
+// without self-loops and parallel edges.
+template<typename Graph>
+SortedAdjacency symmetricAdjacency(const Graph &g, ThreadPool &pool)
+{
+    constexpr std::size_t grain{1024};
+
+    auto n{static_cast<std::size_t>(numVertices(g))};
+    assert(n <= std::numeric_limits<std::uint32_t>::max());
+    auto vertexOf{detail::indexedVertices(g)};
+
+    auto fill{std::vector<std::atomic<std::size_t>>(n + 1)};
+    for (auto &f : fill) {
+        f.store(0, std::memory_order_relaxed);
+    }
+    parallelChunks(pool, n, grain, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto u = first; u < last; ++u) {
+            for (const auto &e : outEdges(vertexOf[u], g)) {
+                auto v{getIndex(target(e, g), g)};
+                if (u != v) {
+                    fill[u].fetch_add(1, std::memory_order_relaxed);
+                    fill[v].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+    });
+    auto offset{std::vector<std::size_t>(n + 1, 0)};
+    for (std::size_t u = 0; u < n; ++u) {
+        offset[u + 1] = offset[u] + fill[u].load(std::memory_order_relaxed);
+        fill[u].store(offset[u], std::memory_order_relaxed);
+    }
+    auto raw{std::vector<std::uint32_t>(offset[n])};
+    parallelChunks(pool, n, grain, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto u = first; u < last; ++u) {
+            for (const auto &e : outEdges(vertexOf[u], g)) {
+                auto v{getIndex(target(e, g), g)};
+                if (u != v) {
+                    raw[fill[u].fetch_add(1, std::memory_order_relaxed)] = static_cast<std::uint32_t>(v);
+                    raw[fill[v].fetch_add(1, std::memory_order_relaxed)] = static_cast<std::uint32_t>(u);
+                }
+            }
+        }
+    });
+
+    // sort each list and drop duplicates, then compact
+    auto unique{std::vector<std::size_t>(n + 1, 0)};
+    parallelChunks(pool, n, grain, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto u = first; u < last; ++u) {
+            auto b{raw.begin() + offset[u]}, e{raw.begin() + offset[u + 1]};
+            std::sort(b, e);
+            unique[u + 1] = static_cast<std::size_t>(std::unique(b, e) - b);
+        }
+    });
+    auto adj{SortedAdjacency{}};
+    adj.offset.assign(n + 1, 0);
+    for (std::size_t u = 0; u < n; ++u) {
+        adj.offset[u + 1] = adj.offset[u] + unique[u + 1];
+    }
+    adj.target.resize(adj.offset[n]);
+    parallelChunks(pool, n, grain, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto u = first; u < last; ++u) {
+            std::copy(raw.begin() + offset[u], raw.begin() + offset[u] + unique[u + 1],
+                      adj.target.begin() + adj.offset[u]);
+        }
+    });
+    return adj;
+}
+
+// Counts the common elements of two sorted lists of distinct values.
+inline std::size_t intersectionSizeScalar(const std::uint32_t *a, const std::uint32_t *aEnd,
+                                          const std::uint32_t *b, const std::uint32_t *bEnd)
+{
+    std::size_t count{0};
+    while (a != aEnd && b != bEnd) {
+        if (*a < *b) {
+            ++a;
+        } else if (*b < *a) {
+            ++b;
+        } else {
+            ++count;
+            ++a;
+            ++b;
+        }
+    }
+    return count;
+}
+
+// As above, comparing a block of each list against all rotations of a block
+// of the other, and advancing the block with the smaller last element.
+inline std::size_t intersectionSize(const std::uint32_t *a, const std::uint32_t *aEnd,
+                                    const std::uint32_t *b, const std::uint32_t *bEnd)
+{
+    std::size_t count{0};
+#if defined(__AVX2__)
+    const auto rotate{_mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0)};
+    while (aEnd - a >= 8 && bEnd - b >= 8) {
+        auto va{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a))};
+        auto vb{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(b))};
+        auto match{_mm256_cmpeq_epi32(va, vb)};
+        for (int r = 1; r < 8; ++r) {
+            vb = _mm256_permutevar8x32_epi32(vb, rotate);
+            match = _mm256_or_si256(match, _mm256_cmpeq_epi32(va, vb));
+        }
+        count += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(match)));
+        auto aMax{a[7]}, bMax{b[7]};
+        a += aMax <= bMax ? 8 : 0;
+        b += bMax <= aMax ? 8 : 0;
+    }
+#elif defined(__SSE2__)
+    while (aEnd - a >= 4 && bEnd - b >= 4) {
+        auto va{_mm_loadu_si128(reinterpret_cast<const __m128i *>(a))};
+        auto vb{_mm_loadu_si128(reinterpret_cast<const __m128i *>(b))};
+        auto match{_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi32(va, vb),
+                         _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)))),
+            _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))),
+                         _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)))))};
+        count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(match)));
+        auto aMax{a[3]}, bMax{b[3]};
+        a += aMax <= bMax ? 4 : 0;
+        b += bMax <= aMax ? 4 : 0;
+    }
+#endif
+    return count + intersectionSizeScalar(a, aEnd, b, bEnd);
+}
+
+} // namespace detail
+
+// Counts the triangles of the simple undirected graph underlying g, i.e. edge
+// directions, self-loops and parallel edges are ignored.
+// Every edge is oriented from the endpoint of lower degree to that of higher
+// degree, ties broken by index, which bounds the out-degrees by O(sqrt(m)).
+// Each triangle is then found exactly once, as the intersection of the sorted
+// oriented neighbour lists of the endpoints of one of its edges. The lists
+// are intersected with AVX2 or SSE2 block comparisons when the compiler
+// targets them, and by a scalar merge otherwise, in parallel over vertices.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+// - numVertices(g) fits in 32 bits
+template<typename Graph>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+std::uint64_t countTriangles(const Graph &g, execution::Parallel policy = execution::par)
+{
+    auto pool{ThreadPool(policy)};
+    auto adj{detail::symmetricAdjacency(g, pool)};
+    auto n{adj.offset.size() - 1};
+
+    auto before = [&](std::size_t u, std::size_t v) {
+        return adj.degree(u) < adj.degree(v) || (adj.degree(u) == adj.degree(v) && u < v);
+    };
+    auto oriented{detail::SortedAdjacency{}};
+    oriented.offset.assign(n + 1, 0);
+    for (std::size_t u = 0; u < n; ++u) {
+        auto higher{std::count_if(adj.begin(u), adj.end(u),
+                                  [&](std::uint32_t v) { return before(u, v); })};
+        oriented.offset[u + 1] = oriented.offset[u] + static_cast<std::size_t>(higher);
+    }
+    oriented.target.resize(oriented.offset[n]);
+    detail::parallelChunks(pool, n, 1024, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto u = first; u < last; ++u) {
+            std::copy_if(adj.begin(u), adj.end(u), oriented.target.begin() + oriented.offset[u],
+                         [&](std::uint32_t v) { return before(u, v); });
+        }
+    });
+
+    auto partials{std::vector<std::uint64_t>(pool.numThreads() * 8, 0)};
+    detail::parallelChunks(pool, n, 256, [&](std::size_t tid, std::size_t first, std::size_t last) {
+        std::uint64_t count{0};
+        for (auto u = first; u < last; ++u) {
+            for (auto p = oriented.begin(u); p != oriented.end(u); ++p) {
+                count += detail::intersectionSize(oriented.begin(u), oriented.end(u),
+                                                  oriented.begin(*p), oriented.end(*p));
+            }
+        }
+        partials[tid * 8] += count; // 8 apart, to keep threads off each other's cache line
+    });
+    std::uint64_t total{0};
+    for (auto p : partials) {
+        total += p;
+    }
+    return total;
+}
+
+// Writes the local clustering coefficient of every vertex v of the simple
+// undirected graph underlying g as put(coefficientMap, v, c): the number of
+// edges between neighbours of v divided by the number of pairs of neighbours,
+// or 0 if v has fewer than two neighbours. The triangles at each vertex are
+// counted by intersecting its sorted neighbour list with those of its
+// neighbours, in parallel over vertices.
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+// - numVertices(g) fits in 32 bits
+// - coefficientMap can be written concurrently for different vertices
+template<typename Graph, typename CoefficientMap>
+requires IncidenceGraph<Graph> && VertexListGraph<Graph>
+void localClusteringCoefficient(const Graph &g, CoefficientMap coefficientMap,
+                                execution::Parallel policy = execution::par)
+{
+    auto pool{ThreadPool(policy)};
+    auto adj{detail::symmetricAdjacency(g, pool)};
+    auto n{adj.offset.size() - 1};
+    auto vertexOf{detail::indexedVertices(g)};
+
+    detail::parallelChunks(pool, n, 256, [&](std::size_t, std::size_t first, std::size_t last) {
+        for (auto u = first; u < last; ++u) {
+            auto d{adj.degree(u)};
+            double coefficient{0};
+            if (d >= 2) {
+                // every triangle at u is seen from both of its other corners
+                std::uint64_t twiceTriangles{0};
+                for (auto p = adj.begin(u); p != adj.end(u); ++p) {
+                    twiceTriangles += detail::intersectionSize(adj.begin(u), adj.end(u),
+                                                               adj.begin(*p), adj.end(*p));
+                }
+                coefficient = static_cast<double>(twiceTriangles)
+                            / (static_cast<double>(d) * static_cast<double>(d - 1));
+            }
+            put(coefficientMap, vertexOf[u], coefficient);
+        }
+    });
+}
+
+} // namespace graph
+
+#endif // GRAPH_TRIANGLES_HPP
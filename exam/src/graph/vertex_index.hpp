@@ -0,0 +1,40 @@
+/**
+ * vertex_index.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * The mapping from vertex indices back to vertex descriptors, shared by the
+ * algorithms working on indices.
+ */
+#ifndef GRAPH_VERTEX_INDEX_HPP
+#define GRAPH_VERTEX_INDEX_HPP
+
+#include "traits.hpp"
+
+#include <vector>
+
+namespace graph {
+namespace detail {
+
+// Returns the vertex descriptor of each vertex of g at position getIndex(v, g).
+// The following pre-conditions are required:
+// - getIndex(v, g) maps the vertices of g onto [0, numVertices(g))
+template<typename Graph>
+std::vector<typename Traits<Graph>::VertexDescriptor> indexedVertices(const Graph &g)
+{
+    auto vertexOf{std::vector<typename Traits<Graph>::VertexDescriptor>(numVertices(g))};
+    for (const auto &v : vertices(g)) {
+        vertexOf[getIndex(v, g)] = v;
+    }
+    return vertexOf;
+}
+
+} // namespace detail
+} // namespace graph
+
+#endif // GRAPH_VERTEX_INDEX_HPP
@@ -0,0 +1,89 @@
+/**
+ * random_graph.hpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Random simple graphs shared by the tests.
+ */
+#ifndef TEST_RANDOM_GRAPH_HPP
+#define TEST_RANDOM_GRAPH_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace test {
+
+using Edge = std::pair<std::size_t, std::size_t>;
+
+namespace detail {
+
+template<typename Rng, typename Draw>
+std::vector<Edge> randomEdges(Rng &rng, Draw &vertex, std::size_t m, bool ascending)
+{
+    auto edges{std::vector<Edge>{}};
+    edges.reserve(m);
+    auto present{std::set<Edge>{}};
+    while (edges.size() < m) {
+        std::size_t u = vertex(rng), v = vertex(rng);
+        if (ascending && u > v) {
+            std::swap(u, v);
+        }
+        if (u != v && present.emplace(u, v).second) {
+            edges.emplace_back(u, v);
+        }
+    }
+    return edges;
+}
+
+} // namespace detail
+
+// The edges of a random simple graph, as AdjacencyList::addEdge requires:
+// m distinct pairs (u, v) with u != v, in the order they were drawn, each
+// endpoint drawn by vertex(rng).
+// The following pre-conditions are required:
+// - vertex draws from more than m distinct pairs
+template<typename Rng, typename Draw>
+requires std::invocable<Draw &, Rng &>
+std::vector<Edge> randomEdges(Rng &rng, Draw vertex, std::size_t m)
+{
+    return detail::randomEdges(rng, vertex, m, false);
+}
+
+// As above, with the endpoints drawn uniformly from [0, n).
+template<typename Rng>
+std::vector<Edge> randomEdges(Rng &rng, std::size_t n, std::size_t m)
+{
+    auto vertex{std::uniform_int_distribution<std::size_t>(0, n - 1)};
+    return detail::randomEdges(rng, vertex, m, false);
+}
+
+// The edges of a random simple DAG: m distinct pairs (u, v) with u < v, so
+// that (u, v) and (v, u) are drawn as the same pair. Adding both directions
+// of each pair thus gives a simple undirected graph.
+template<typename Rng, typename Draw>
+requires std::invocable<Draw &, Rng &>
+std::vector<Edge> randomDagEdges(Rng &rng, Draw vertex, std::size_t m)
+{
+    return detail::randomEdges(rng, vertex, m, true);
+}
+
+// As above, with the endpoints drawn uniformly from [0, n).
+template<typename Rng>
+std::vector<Edge> randomDagEdges(Rng &rng, std::size_t n, std::size_t m)
+{
+    auto vertex{std::uniform_int_distribution<std::size_t>(0, n - 1)};
+    return detail::randomEdges(rng, vertex, m, true);
+}
+
+} // namespace test
+
+#endif // TEST_RANDOM_GRAPH_HPP
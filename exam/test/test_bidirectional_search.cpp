@@ -0,0 +1,159 @@
+/**
+ * test_bidirectional_search.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of bidirectional point-to-point search, unweighted and weighted, on a
+ * small example and against breadth-first search and Dijkstra's algorithm on
+ * a random graph.
+ */
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/bidirectional_search.hpp>
+#include <graph/concepts.hpp>
+#include <graph/dijkstra.hpp>
+#include <graph/property_map.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Bidirectional, graph::NoProp, double>;
+
+// Plain breadth-first search distances from s, to compare against.
+std::vector<std::size_t> bfsDistances(const Graph &g, std::size_t s)
+{
+    auto dist{std::vector<std::size_t>(numVertices(g), graph::infiniteDistance<std::size_t>())};
+    auto queue{std::vector<std::size_t>{s}};
+    dist[s] = 0;
+    for (std::size_t i = 0; i < queue.size(); ++i) {
+        for (auto e : outEdges(queue[i], g)) {
+            if (dist[target(e, g)] == graph::infiniteDistance<std::size_t>()) {
+                dist[target(e, g)] = dist[queue[i]] + 1;
+                queue.push_back(target(e, g));
+            }
+        }
+    }
+    return dist;
+}
+
+// The weight of the lightest edge from u to v, or infinity if there is none.
+double edgeWeight(const Graph &g, std::size_t u, std::size_t v)
+{
+    auto w{graph::infiniteDistance<double>()};
+    for (auto e : outEdges(u, g)) {
+        if (target(e, g) == v) {
+            w = std::min(w, g[e]);
+        }
+    }
+    return w;
+}
+
+// The length of path if it is a path of g from s to t, otherwise infinity.
+double pathLength(const Graph &g, const std::vector<std::size_t> &path, std::size_t s, std::size_t t)
+{
+    if (path.empty() || path.front() != s || path.back() != t) {
+        return graph::infiniteDistance<double>();
+    }
+    double length{0};
+    for (std::size_t i = 0; i + 1 < path.size(); ++i) {
+        length += edgeWeight(g, path[i], path[i + 1]);
+    }
+    return length;
+}
+
+void printPath(const std::vector<std::size_t> &path)
+{
+    for (auto v : path) {
+        std::cout << v << ' ';
+    }
+}
+
+int main()
+{
+    auto g{Graph(7)};
+    addEdge(0, 1, 1.0, g);
+    addEdge(1, 2, 1.0, g);
+    addEdge(2, 3, 1.0, g);
+    addEdge(3, 4, 1.0, g);
+    addEdge(0, 5, 4.0, g);
+    addEdge(5, 4, 4.0, g);
+    addEdge(4, 6, 1.0, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of bidirectional search\n";
+    std::cout << "a path 0 1 2 3 4 6 with unit weights, and a shortcut 0 5 4 of weight 8\n\n";
+    std::cout << "Expected fewest edges, shortest path, and no path from 6 to 0:\n";
+    std::cout << "0 5 4 6 | 0 1 2 3 4 6 (5) | none\n";
+
+    bool ok{true};
+    auto hops{graph::shortestPath(g, 0, 6)};
+    auto weighted{graph::shortestPath(g, 0, 6, graph::makeEdgePropMap(g))};
+    auto none{graph::shortestPath(g, 6, 0)};
+    std::cout << "\nResult:\n";
+    if (hops) {
+        printPath(*hops);
+    }
+    std::cout << "| ";
+    if (weighted) {
+        printPath(weighted->vertices);
+        std::cout << '(' << weighted->length << ") ";
+    }
+    std::cout << "| " << (none ? "some" : "none") << '\n';
+    ok = ok && hops == std::vector<std::size_t>{0, 5, 4, 6};
+    ok = ok && weighted && weighted->length == 5
+         && weighted->vertices == std::vector<std::size_t>{0, 1, 2, 3, 4, 6};
+    ok = ok && !none;
+
+    const std::size_t n{5000}, m{15000}, queries{200};
+    auto r{Graph(n)};
+    auto rng{std::mt19937(42)};
+    auto vertex{std::uniform_int_distribution<std::size_t>(0, n - 1)};
+    auto weight{std::uniform_int_distribution<int>(1, 100)};
+    for (auto [u, v] : test::randomEdges(rng, n, m)) {
+        addEdge(u, v, static_cast<double>(weight(rng)), r);
+    }
+
+    std::cout << "\nRandom graph with " << n << " vertices and " << m << " edges, "
+              << queries << " queries sharing workspaces\n";
+    std::cout << "Expected: path lengths equal to breadth-first search and Dijkstra\n";
+    auto hopWorkspace{graph::BidirectionalSearchWorkspace<Graph>{}};
+    auto weightWorkspace{graph::BidirectionalSearchWorkspace<Graph, double>{}};
+    auto dist{std::vector<double>(n)};
+    auto pred{std::vector<std::size_t>(n)};
+    std::size_t mismatches{0}, unreachable{0};
+    for (std::size_t q = 0; q < queries; ++q) {
+        auto s{vertex(rng)};
+        auto t{q % 50 == 0 ? s : vertex(rng)};
+        auto hopDist{bfsDistances(r, s)};
+        graph::dijkstra(r, s, graph::makeEdgePropMap(r),
+                        graph::makeIteratorVertexMap(dist.begin(), r),
+                        graph::makeIteratorVertexMap(pred.begin(), r));
+        auto p{graph::shortestPath(r, s, t, hopWorkspace)};
+        auto w{graph::shortestPath(r, s, t, graph::makeEdgePropMap(r), weightWorkspace)};
+        if (hopDist[t] == graph::infiniteDistance<std::size_t>()) {
+            ++unreachable;
+            mismatches += p || w;
+            continue;
+        }
+        bool good{p && p->size() == hopDist[t] + 1
+                  && pathLength(r, *p, s, t) != graph::infiniteDistance<double>()};
+        good = good && w && w->length == dist[t] && pathLength(r, w->vertices, s, t) == dist[t];
+        mismatches += !good;
+    }
+    std::cout << "Result: " << mismatches << " mismatches (" << unreachable
+              << " pairs unreachable)\n";
+    ok = ok && mismatches == 0;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,94 @@
+/**
+ * test_connected_components.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of connected components using the example in Figure 21.1 from
+ * CLRS p. 563, on both AdjacencyList and AdjacencyMatrix, and of the
+ * parallel algorithm against the sequential one on a random graph.
+ */
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/adjacency_matrix.hpp>
+#include <graph/concepts.hpp>
+#include <graph/connected_components.hpp>
+#include <graph/property_map.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+template<typename Graph>
+void addFigure(Graph &g)
+{
+    // a=0, b=1, c=2, d=3, e=4, f=5, g=6, h=7, i=8, j=9
+    addEdge(1, 3, g);
+    addEdge(4, 6, g);
+    addEdge(0, 2, g);
+    addEdge(7, 8, g);
+    addEdge(0, 1, g);
+    addEdge(4, 5, g);
+    addEdge(1, 2, g);
+}
+
+int main()
+{
+    using List = graph::AdjacencyList<graph::tags::Directed>;
+    using Matrix = graph::AdjacencyMatrix;
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of connected components\n";
+    std::cout << "using Figure 21.1 from CLRS p. 563 as an example\n\n";
+    std::cout << "Expected components:\n";
+    std::cout << "a: 0  b: 0  c: 0  d: 0  e: 1  f: 1  g: 1  h: 2  i: 2  j: 3\n";
+
+    auto expected{std::vector<std::size_t>{0, 0, 0, 0, 1, 1, 1, 2, 2, 3}};
+    auto list{List(10)};
+    auto matrix{Matrix(10)};
+    addFigure(list);
+    addFigure(matrix);
+
+    bool ok{true};
+    auto check = [&](const char *what, const auto &g, auto policy) {
+        auto comp{std::vector<std::size_t>(10)};
+        auto num{graph::connectedComponents(g, graph::makeIteratorVertexMap(comp.begin(), g), policy)};
+        std::cout << '\n' << what << ":\n";
+        for (auto v : vertices(g)) {
+            std::cout << static_cast<char>('a' + v) << ": " << comp[v] << "  ";
+        }
+        std::cout << '\n';
+        ok = ok && num == 4 && comp == expected;
+    };
+    check("AdjacencyList, sequential", list, graph::execution::seq);
+    check("AdjacencyList, parallel", list, graph::execution::Parallel{4});
+    check("AdjacencyMatrix, sequential", matrix, graph::execution::seq);
+    check("AdjacencyMatrix, parallel", matrix, graph::execution::Parallel{4});
+
+    std::cout << "\nRandom graph with 200000 vertices and 300000 edges, 4 threads\n";
+    auto rg{List(200000)};
+    auto gen{std::mt19937(23)};
+    for (auto [u, v] : test::randomEdges(gen, 200000, 300000)) {
+        addEdge(u, v, rg);
+    }
+    auto comp{std::vector<std::size_t>(numVertices(rg))};
+    auto pcomp{std::vector<std::size_t>(numVertices(rg))};
+    auto num{graph::connectedComponents(rg, graph::makeIteratorVertexMap(comp.begin(), rg))};
+    auto pnum{graph::connectedComponents(rg, graph::makeIteratorVertexMap(pcomp.begin(), rg),
+                                         graph::execution::Parallel{4})};
+    auto rok{num == pnum && comp == pcomp};
+    std::cout << "Components: " << num << ", parallel and sequential agree: "
+              << (rok ? "yes" : "no") << '\n';
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+/**
+ * test_core_numbers.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of the sequential and parallel k-core decomposition on a small
+ * example, and on a random graph compared against naive peeling.
+ */
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/core_numbers.hpp>
+#include <graph/property_map.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Directed>;
+
+// Removes vertices of degree below k until none remain, for k = 1, 2, ...
+std::vector<std::size_t> naiveCoreNumbers(const std::vector<std::vector<std::size_t>> &adj)
+{
+    auto n{adj.size()};
+    auto core{std::vector<std::size_t>(n, 0)};
+    auto inCore{std::vector<bool>(n, true)};
+    for (std::size_t k = 1;; ++k) {
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (std::size_t v = 0; v < n; ++v) {
+                auto d{std::count_if(adj[v].begin(), adj[v].end(),
+                                     [&](std::size_t u) { return inCore[u]; })};
+                if (inCore[v] && static_cast<std::size_t>(d) < k) {
+                    inCore[v] = false;
+                    changed = true;
+                }
+            }
+        }
+        if (std::none_of(inCore.begin(), inCore.end(), [](bool b) { return b; })) {
+            return core;
+        }
+        for (std::size_t v = 0; v < n; ++v) {
+            core[v] += inCore[v];
+        }
+    }
+}
+
+int main()
+{
+    // A complete graph on 0..3, a pendant vertex 4 at 3, a triangle 5-6-7
+    // joined by the edge 3-5, and an isolated vertex 8, stored with both
+    // directions of every edge.
+    auto g{Graph(9)};
+    auto addBoth = [&g](std::size_t u, std::size_t v) {
+        addEdge(u, v, g);
+        addEdge(v, u, g);
+    };
+    for (std::size_t u = 0; u < 4; ++u) {
+        for (std::size_t v = u + 1; v < 4; ++v) {
+            addBoth(u, v);
+        }
+    }
+    addBoth(3, 4);
+    addBoth(3, 5);
+    addBoth(5, 6);
+    addBoth(6, 7);
+    addBoth(7, 5);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of the k-core decomposition\n\n";
+
+    std::cout << "Expected core numbers (degeneracy 3):\n";
+    std::cout << "0: 3  1: 3  2: 3  3: 3  4: 1  5: 2  6: 2  7: 2  8: 0\n";
+
+    auto core{std::vector<std::size_t>(numVertices(g))};
+    auto k{graph::coreNumbers(g, graph::makeIteratorVertexMap(core.begin(), g))};
+    std::cout << "\nResult (degeneracy " << k << "):\n";
+    for (auto v : vertices(g)) {
+        std::cout << v << ": " << core[v] << "  ";
+    }
+    std::cout << '\n';
+
+    auto parCore{std::vector<std::size_t>(numVertices(g))};
+    auto parK{graph::coreNumbers(g, graph::makeIteratorVertexMap(parCore.begin(), g),
+                                 graph::execution::Parallel{4})};
+    auto expected{std::vector<std::size_t>{3, 3, 3, 3, 1, 2, 2, 2, 0}};
+    bool ok{k == 3 && parK == 3 && core == expected && parCore == expected};
+
+    std::cout << "\nRandom graph with 2000 vertices and 30000 edges, 4 threads\n";
+    const std::size_t n{2000};
+    auto rg{Graph(n)};
+    auto adj{std::vector<std::vector<std::size_t>>(n)};
+    auto gen{std::mt19937(42)};
+    // skewed endpoints, so the cores are nested several levels deep
+    auto pick{std::geometric_distribution<std::size_t>(0.003)};
+    auto vertex{[&](std::mt19937 &rng) { return pick(rng) % n; }};
+    // distinct unordered pairs, so neither direction is added twice
+    for (auto [u, v] : test::randomDagEdges(gen, vertex, 30000)) {
+        addEdge(u, v, rg);
+        addEdge(v, u, rg);
+        adj[u].push_back(v);
+        adj[v].push_back(u);
+    }
+    auto naive{naiveCoreNumbers(adj)};
+    auto rcore{std::vector<std::size_t>(n)}, rparCore{std::vector<std::size_t>(n)};
+    auto rk{graph::coreNumbers(rg, graph::makeIteratorVertexMap(rcore.begin(), rg))};
+    auto rparK{graph::coreNumbers(rg, graph::makeIteratorVertexMap(rparCore.begin(), rg),
+                                  graph::execution::Parallel{4})};
+    auto naiveK{*std::max_element(naive.begin(), naive.end())};
+    bool rok{rcore == naive && rparCore == naive && rk == naiveK && rparK == naiveK};
+    std::cout << "Sequential and parallel core numbers (degeneracy " << naiveK
+              << ") agree with naive peeling: " << (rok ? "yes" : "no") << '\n';
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+/**
+ * test_critical_path.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of critical path analysis on a small project network, and on a random
+ * DAG comparing the sequential and parallel versions.
+ */
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/critical_path.hpp>
+#include <graph/property_map.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Directed>;
+
+int main()
+{
+    // Tasks A=0 (3), B=1 (2), C=2 (4), D=3 (2), E=4 (3), F=5 (1), where
+    // C and D wait for A, D also for B, E for C and D, and F for E.
+    auto g{Graph(6)};
+    auto duration{std::vector<int>{3, 2, 4, 2, 3, 1}};
+    addEdge(0, 2, g);
+    addEdge(0, 3, g);
+    addEdge(1, 3, g);
+    addEdge(2, 4, g);
+    addEdge(3, 4, g);
+    addEdge(4, 5, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of critical path analysis\n\n";
+
+    std::cout << "Expected (earliest start, latest start, slack):\n";
+    std::cout << "A: 0 0 0  B: 0 3 3  C: 3 3 0  D: 3 5 2  E: 7 7 0  F: 10 10 0\n";
+    std::cout << "Expected makespan 11, critical chain A C E F\n";
+
+    auto res{graph::criticalPath(g, graph::makeIteratorVertexMap(duration.begin(), g))};
+    std::cout << "\nResult:\n";
+    for (auto v : vertices(g)) {
+        std::cout << char('A' + v) << ": " << res.earliestStart[v] << ' ' << res.latestStart[v]
+                  << ' ' << res.slack[v] << "  ";
+    }
+    std::cout << "\nResult makespan " << res.makespan << ", critical chain";
+    for (auto v : res.chain) {
+        std::cout << ' ' << char('A' + v);
+    }
+    std::cout << '\n';
+    bool ok{res.earliestStart == std::vector<int>{0, 0, 3, 3, 7, 10}
+            && res.latestStart == std::vector<int>{0, 3, 3, 5, 7, 10}
+            && res.slack == std::vector<int>{0, 3, 0, 2, 0, 0}
+            && res.makespan == 11 && res.chain == std::vector<std::size_t>{0, 2, 4, 5}};
+
+    std::cout << "\nRandom DAG with 20000 vertices and 100000 edges, 4 threads\n";
+    const std::size_t n{20000};
+    auto rg{Graph(n)};
+    auto rank{std::vector<std::size_t>(n)};
+    std::iota(rank.begin(), rank.end(), std::size_t{0});
+    auto gen{std::mt19937(42)};
+    std::shuffle(rank.begin(), rank.end(), gen);
+    // distinct unordered pairs, oriented by rank
+    for (auto [u, v] : test::randomDagEdges(gen, n, 100000)) {
+        if (rank[u] < rank[v]) {
+            addEdge(u, v, rg);
+        } else {
+            addEdge(v, u, rg);
+        }
+    }
+    auto rduration{std::vector<long>(n)};
+    auto pickDuration{std::uniform_int_distribution<long>(0, 100)};
+    for (auto &d : rduration) {
+        d = pickDuration(gen);
+    }
+    auto durationMap{graph::makeIteratorVertexMap(rduration.begin(), rg)};
+    auto seq{graph::criticalPath(rg, durationMap)};
+    auto par{graph::criticalPath(rg, durationMap, graph::execution::Parallel{4})};
+    auto levels{graph::topoSortLevels(rg, graph::execution::Parallel{4})};
+    auto reused{graph::criticalPath(rg, durationMap, levels, graph::execution::Parallel{4})};
+
+    auto same = [](const auto &a, const auto &b) {
+        return a.earliestStart == b.earliestStart && a.latestStart == b.latestStart
+            && a.slack == b.slack && a.makespan == b.makespan && a.chain == b.chain;
+    };
+    long chainLength{0};
+    bool chainOk{true};
+    for (std::size_t i = 0; i < seq.chain.size(); ++i) {
+        auto v{seq.chain[i]};
+        chainLength += rduration[v];
+        chainOk = chainOk && seq.slack[v] == 0;
+        if (i + 1 < seq.chain.size()) {
+            auto out{outEdges(v, rg)};
+            chainOk = chainOk && std::any_of(out.begin(), out.end(), [&](auto e) {
+                return target(e, rg) == seq.chain[i + 1];
+            });
+        }
+    }
+    bool rok{same(seq, par) && same(seq, reused) && chainOk && chainLength == seq.makespan
+             && std::all_of(seq.slack.begin(), seq.slack.end(), [](long s) { return s >= 0; })};
+    std::cout << "Makespan " << seq.makespan << " over a chain of " << seq.chain.size()
+              << " tasks, parallel and sequential agree: " << (rok ? "yes" : "no") << '\n';
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok ? 0 : 1;
+}
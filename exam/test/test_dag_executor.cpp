@@ -0,0 +1,147 @@
+/**
+ * test_dag_executor.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of the parallel DAG executor using the example in
+ * Figure 22.7 from CLRS p. 613 as a dependency graph.
+ */
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/concepts.hpp>
+#include <graph/dag_executor.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Directed, std::string>;
+
+bool dependenciesRespected(const Graph &g, const graph::DagExecutionReport &report)
+{
+    for (auto e : edges(g)) {
+        auto u{source(e, g)}, v{target(e, g)};
+        if (report.status[v] == graph::TaskStatus::Skipped) {
+            continue;
+        }
+        if (report.status[u] != graph::TaskStatus::Succeeded
+                || report.timing[u].finish > report.timing[v].start) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void printReport(const Graph &g, const graph::DagExecutionReport &report)
+{
+    for (auto v : vertices(g)) {
+        std::cout << std::setfill(' ') << std::setw(12) << g[v] << ": ";
+        switch (report.status[v]) {
+        case graph::TaskStatus::Succeeded:
+            std::cout << "succeeded";
+            break;
+        case graph::TaskStatus::Failed:
+            std::cout << "failed";
+            break;
+        case graph::TaskStatus::Skipped:
+            std::cout << "skipped";
+            break;
+        }
+        std::cout << '\n';
+    }
+}
+
+int main()
+{
+    auto g{Graph()};
+    for (auto name : {"shirt", "tie", "jacket", "belt", "watch",
+                      "pants", "undershorts", "socks", "shoes"}) {
+        addVertex(std::string{name}, g);
+    }
+    addEdge(0, 1, g);
+    addEdge(0, 3, g);
+    addEdge(1, 2, g);
+    addEdge(3, 2, g);
+    addEdge(5, 3, g);
+    addEdge(5, 8, g);
+    addEdge(6, 5, g);
+    addEdge(6, 8, g);
+    addEdge(7, 8, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of the parallel DAG executor, 4 threads\n";
+    std::cout << "using Figure 22.7 from CLRS p. 613 as an example\n\n";
+
+    std::atomic<int> ran{0};
+    auto report{graph::executeDag(g, [&](std::size_t) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        ++ran;
+    }, graph::execution::Parallel{4})};
+    std::cout << "All tasks succeeded: " << (report.succeeded() ? "yes" : "no") << '\n';
+    bool ok{report.succeeded() && ran == 9 && dependenciesRespected(g, report)};
+    std::cout << "Every task started after its dependencies finished: "
+              << (dependenciesRespected(g, report) ? "yes" : "no") << '\n';
+
+    std::cout << "\nLetting pants fail, expected:\n";
+    std::cout << "belt, jacket and shoes skipped, pants failed, the rest succeeded\n";
+    std::cout << "\nResult:\n";
+    auto failing{graph::executeDag(g, [&](std::size_t v) {
+        if (g[v] == "pants") {
+            throw std::runtime_error("no pants");
+        }
+    }, graph::execution::Parallel{4})};
+    printReport(g, failing);
+    ok = ok && dependenciesRespected(g, failing) && failing.error[5]
+            && failing.status[5] == graph::TaskStatus::Failed
+            && failing.status[3] == graph::TaskStatus::Skipped
+            && failing.status[2] == graph::TaskStatus::Skipped
+            && failing.status[8] == graph::TaskStatus::Skipped
+            && failing.status[1] == graph::TaskStatus::Succeeded
+            && failing.status[4] == graph::TaskStatus::Succeeded;
+
+    std::cout << "\n100 runs of a random DAG with 2000 tasks on one pool of 4 threads\n";
+    auto rg{Graph(2000)};
+    auto gen{std::mt19937(11)};
+    for (auto [u, v] : test::randomDagEdges(gen, 2000, 3000)) {
+        addEdge(u, v, rg);
+    }
+    auto pool{graph::ThreadPool(4)};
+    bool rok{true};
+    for (int run = 0; run < 100; ++run) {
+        std::atomic<int> count{0};
+        auto r{graph::executeDag(rg, [&](std::size_t) { ++count; }, pool)};
+        rok = rok && r.succeeded() && count == 2000 && dependenciesRespected(rg, r);
+    }
+    std::cout << "Every run ran all tasks after their dependencies: "
+              << (rok ? "yes" : "no") << '\n';
+    ok = ok && rok;
+
+    std::cout << "\nAdding jacket -> pants, which closes a cycle: ";
+    addEdge(2, 5, g);
+    bool thrown{false};
+    try {
+        graph::executeDag(g, [](std::size_t) { }, graph::execution::Parallel{4});
+    } catch (const graph::NotADagError &err) {
+        thrown = true;
+    }
+    std::cout << (thrown ? "NotADagError thrown" : "no error") << '\n';
+    ok = ok && thrown;
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok ? 0 : 1;
+}
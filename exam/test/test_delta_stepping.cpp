@@ -0,0 +1,128 @@
+/**
+ * test_delta_stepping.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of delta-stepping using the example in Figure 24.6 from CLRS p. 659,
+ * and against Dijkstra's algorithm on random graphs for several deltas, and
+ * on graphs with one edge far heavier than delta.
+ */
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/concepts.hpp>
+#include <graph/delta_stepping.hpp>
+#include <graph/dijkstra.hpp>
+#include <graph/property_map.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+template<typename Graph, typename Distance>
+std::vector<Distance> dijkstraDistances(const Graph &g, std::size_t s)
+{
+    auto dist{std::vector<Distance>(numVertices(g))};
+    auto pred{std::vector<std::size_t>(numVertices(g))};
+    graph::dijkstra(g, s, graph::makeEdgePropMap(g),
+                    graph::makeIteratorVertexMap(dist.begin(), g),
+                    graph::makeIteratorVertexMap(pred.begin(), g));
+    return dist;
+}
+
+int main()
+{
+    using Graph = graph::AdjacencyList<graph::tags::Directed, graph::NoProp, double>;
+    using IntGraph = graph::AdjacencyList<graph::tags::Directed, graph::NoProp, unsigned>;
+
+    // s=0, t=1, x=2, y=3, z=4
+    const char *names{"stxyz"};
+    auto g{Graph(5)};
+    addEdge(0, 1, 10.0, g);
+    addEdge(0, 3, 5.0, g);
+    addEdge(1, 2, 1.0, g);
+    addEdge(1, 3, 2.0, g);
+    addEdge(2, 4, 4.0, g);
+    addEdge(3, 1, 3.0, g);
+    addEdge(3, 2, 9.0, g);
+    addEdge(3, 4, 2.0, g);
+    addEdge(4, 0, 7.0, g);
+    addEdge(4, 2, 6.0, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of delta-stepping shortest paths, 4 threads\n";
+    std::cout << "using Figure 24.6 from CLRS p. 659 as an example, source s, delta 3\n\n";
+    std::cout << "Expected distances:\n";
+    std::cout << "s: 0  t: 8  x: 9  y: 5  z: 7\n";
+
+    auto dist{graph::deltaStepping(g, 0, graph::makeEdgePropMap(g), 3.0,
+                                   graph::execution::Parallel{4})};
+    std::cout << "\nResult:\n";
+    for (auto v : vertices(g)) {
+        std::cout << names[v] << ": " << dist[v] << "  ";
+    }
+    std::cout << '\n';
+    bool ok{dist == std::vector<double>{0, 8, 9, 5, 7}};
+
+    std::cout << "\nRandom graphs with 20000 vertices and 100000 edges\n";
+    auto gen{std::mt19937(5)};
+    auto rg{Graph(20000)};
+    auto weight{std::uniform_real_distribution<double>(0.0, 1.0)};
+    auto ig{IntGraph(20000)};
+    auto iweight{std::uniform_int_distribution<unsigned>(1, 1000)};
+    for (auto [u, v] : test::randomEdges(gen, 20000, 100000)) {
+        addEdge(u, v, weight(gen), rg);
+        addEdge(u, v, iweight(gen), ig);
+    }
+    auto expected{dijkstraDistances<Graph, double>(rg, 0)};
+    auto iexpected{dijkstraDistances<IntGraph, unsigned>(ig, 0)};
+    for (double delta : {0.01, 0.1, 1.0}) {
+        auto res{graph::deltaStepping(rg, 0, graph::makeEdgePropMap(rg), delta,
+                                      graph::execution::Parallel{4})};
+        std::cout << "real weights, delta " << delta << ": "
+                  << (res == expected ? "same as Dijkstra" : "differs from Dijkstra") << '\n';
+        ok = ok && res == expected;
+    }
+    for (unsigned delta : {1u, 100u, 5000u}) {
+        auto res{graph::deltaStepping(ig, 0, graph::makeEdgePropMap(ig), delta,
+                                      graph::execution::Parallel{4})};
+        std::cout << "integer weights, delta " << delta << ": "
+                  << (res == iexpected ? "same as Dijkstra" : "differs from Dijkstra") << '\n';
+        ok = ok && res == iexpected;
+    }
+
+    std::cout << "\nTwo random halves of 1000 vertices joined by one edge of weight 1e9,\n"
+                 "the others at most 1, delta 0.01, so 1e11 buckets apart\n";
+    auto hg{Graph(2000)};
+    auto ihg{IntGraph(2000)};
+    auto iheavyWeight{std::uniform_int_distribution<unsigned>(1, 10)};
+    for (std::size_t half : {0, 1000}) {
+        for (auto [u, v] : test::randomEdges(gen, 1000, 5000)) {
+            addEdge(half + u, half + v, weight(gen), hg);
+            addEdge(half + u, half + v, iheavyWeight(gen), ihg);
+        }
+    }
+    addEdge(0, 1000, 1e9, hg);
+    addEdge(0, 1000, 3000000000u, ihg);
+    auto hres{graph::deltaStepping(hg, 0, graph::makeEdgePropMap(hg), 0.01,
+                                   graph::execution::Parallel{4})};
+    auto ihres{graph::deltaStepping(ihg, 0, graph::makeEdgePropMap(ihg), 1u,
+                                    graph::execution::Parallel{4})};
+    auto hok{hres == dijkstraDistances<Graph, double>(hg, 0)
+             && ihres == dijkstraDistances<IntGraph, unsigned>(ihg, 0)};
+    std::cout << "real and integer weights (3e9, delta 1): "
+              << (hok ? "same as Dijkstra" : "differs from Dijkstra") << '\n';
+    ok = ok && hok;
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+/**
+ * test_dfs_control.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of stopping and pruning a depth-first search from the visitor, using
+ * the example in Figure 22.4 from CLRS p. 605.
+ */
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/depth_first_search.hpp>
+#include <graph/tags.hpp>
+
+using Graph = graph::AdjacencyList<graph::tags::Directed>;
+
+// Stops at the first back edge, remembering it.
+struct CycleVisitor : graph::DFSNullVisitor
+{
+    template<typename G, typename E>
+    graph::DFSControl backEdge(const E &e, const G &g)
+    {
+        *found = {source(e, g), target(e, g)};
+        return graph::DFSControl::Stop;
+    }
+
+    std::pair<std::size_t, std::size_t> *found;
+};
+
+// Records the discovered vertices, stopping at goal and not exploring below
+// prune.
+struct GoalVisitor : graph::DFSNullVisitor
+{
+    template<typename G, typename V>
+    graph::DFSControl discoverVertex(const V &v, const G &g)
+    {
+        discovered->push_back(v);
+        if (v == goal) {
+            return graph::DFSControl::Stop;
+        }
+        return v == prune ? graph::DFSControl::Prune : graph::DFSControl::Continue;
+    }
+
+    std::vector<std::size_t> *discovered;
+    std::size_t goal, prune;
+};
+
+// Counts the finished vertices, with void hooks.
+struct CountingVisitor : graph::DFSNullVisitor
+{
+    template<typename G, typename V>
+    void finishVertex(const V &, const G &)
+    {
+        ++*finished;
+    }
+
+    std::size_t *finished;
+};
+
+int main()
+{
+    // u=0, v=1, w=2, x=3, y=4, z=5
+    auto g{Graph(6)};
+    addEdge(0, 1, g);
+    addEdge(0, 3, g);
+    addEdge(1, 4, g);
+    addEdge(2, 4, g);
+    addEdge(2, 5, g);
+    addEdge(3, 1, g);
+    addEdge(4, 3, g);
+    addEdge(5, 5, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of stopping and pruning depth-first search\n";
+    std::cout << "using Figure 22.4 from CLRS p. 605 as an example\n\n";
+
+    std::cout << "Expected first back edge (x, v), search stopped: 3 1 0\n";
+    std::cout << "Expected discovered until z, pruning below v: 0 1 3 2 4 5\n";
+    std::cout << "Expected discovered until w, pruning below u: 0 1 4 3 2\n";
+    std::cout << "Expected finished vertices with void hooks, search completed: 6 1\n";
+
+    auto found{std::pair<std::size_t, std::size_t>{}};
+    bool completed{graph::dfs(g, CycleVisitor{{}, &found})};
+    std::cout << "\nResult first back edge, search stopped: " << found.first << ' ' << found.second
+              << ' ' << completed << '\n';
+    bool ok{found == std::pair<std::size_t, std::size_t>{3, 1} && !completed};
+
+    auto discovered{std::vector<std::size_t>{}};
+    completed = graph::dfs(g, GoalVisitor{{}, &discovered, 5, 1});
+    std::cout << "Result discovered until z, pruning below v:";
+    for (auto v : discovered) {
+        std::cout << ' ' << v;
+    }
+    std::cout << '\n';
+    ok = ok && !completed && discovered == std::vector<std::size_t>{0, 1, 3, 2, 4, 5};
+
+    discovered.clear();
+    completed = graph::dfs(g, GoalVisitor{{}, &discovered, 2, 0});
+    std::cout << "Result discovered until w, pruning below u:";
+    for (auto v : discovered) {
+        std::cout << ' ' << v;
+    }
+    std::cout << '\n';
+    ok = ok && !completed && discovered == std::vector<std::size_t>{0, 1, 4, 3, 2};
+
+    std::size_t finished{0};
+    completed = graph::dfs(g, CountingVisitor{{}, &finished});
+    std::cout << "Result finished vertices with void hooks, search completed: " << finished
+              << ' ' << completed << '\n';
+    ok = ok && finished == 6 && completed;
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+/**
+ * test_dfs_events.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of the detection of the visitor hooks a depth-first search must call,
+ * and of the search with only some hooks overridden.
+ */
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/depth_first_search.hpp>
+#include <graph/tags.hpp>
+#include <graph/topological_sort.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Directed>;
+using graph::detail::dfsEvents;
+
+// Overrides finishVertex with a member template, as TopoVisitor does.
+struct FinishOnly : graph::DFSNullVisitor
+{
+    std::vector<std::size_t> *order;
+
+    template<typename G, typename V>
+    void finishVertex(const V &v, const G &) { order->push_back(v); }
+};
+
+// Overrides discoverVertex and treeEdge with plain member functions.
+struct DiscoverAndTree : graph::DFSNullVisitor
+{
+    std::vector<std::size_t> *order;
+    std::size_t *treeEdges;
+
+    void discoverVertex(std::size_t v, const Graph &) { order->push_back(v); }
+    void treeEdge(Graph::EdgeDescriptor, const Graph &) { ++*treeEdges; }
+};
+
+// Brings the hook of DFSNullVisitor into scope next to a plain overload,
+// which the call of the hook resolves to for a vertex of Graph.
+struct UsingAndOverload : graph::DFSNullVisitor
+{
+    using graph::DFSNullVisitor::discoverVertex;
+
+    std::size_t *discoveries;
+
+    void discoverVertex(const std::size_t &, const Graph &) { ++*discoveries; }
+};
+
+// Overrides everything, counting the calls per hook, and records the finish
+// order.
+struct Everything
+{
+    std::vector<std::size_t> *order;
+    std::size_t *calls;
+
+    template<typename G, typename V> void initVertex(const V &, const G &) { ++calls[0]; }
+    template<typename G, typename V> void startVertex(const V &, const G &) { ++calls[1]; }
+    template<typename G, typename V> void discoverVertex(const V &, const G &) { ++calls[2]; }
+    template<typename G, typename V> void finishVertex(const V &v, const G &)
+    {
+        ++calls[3];
+        order->push_back(v);
+    }
+    template<typename G, typename E> void examineEdge(const E &, const G &) { ++calls[4]; }
+    template<typename G, typename E> void treeEdge(const E &, const G &) { ++calls[5]; }
+    template<typename G, typename E> void backEdge(const E &, const G &) { ++calls[6]; }
+    template<typename G, typename E> void forwardOrCrossEdge(const E &, const G &) { ++calls[7]; }
+    template<typename G, typename E> void finishEdge(const E &, const G &) { ++calls[8]; }
+};
+
+using namespace graph::detail;
+static_assert(dfsEvents<graph::DFSNullVisitor, Graph>() == 0);
+static_assert(dfsEvents<FinishOnly, Graph>() == FinishVertex);
+static_assert(dfsEvents<TopoVisitor<std::back_insert_iterator<std::vector<std::size_t>>>,
+                        Graph>() == FinishVertex);
+static_assert(dfsEvents<DiscoverAndTree, Graph>() == (DiscoverVertex | TreeEdge));
+static_assert(dfsEvents<UsingAndOverload, Graph>() == DiscoverVertex);
+static_assert(dfsEvents<Everything, Graph>() == 0x1ff);
+
+int main()
+{
+    auto rng{std::mt19937(42)};
+    const std::size_t n{2000}, m{8000};
+    auto g{Graph(n)};
+    for (auto [u, v] : test::randomEdges(rng, n, m)) {
+        addEdge(u, v, g);
+    }
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of depth-first search with only some visitor hooks overridden\n";
+    std::cout << "on a random graph with " << n << " vertices and " << m << " edges\n\n";
+    std::cout << "Expected: the finish and discover orders and the number of tree edges of a\n"
+                 "visitor overriding every hook, and n - roots tree edges, and as many\n"
+                 "discoveries through an overload of the inherited hook\n";
+
+    std::size_t calls[9]{};
+    auto fullFinish{std::vector<std::size_t>{}};
+    graph::dfs(g, Everything{&fullFinish, calls});
+
+    auto finish{std::vector<std::size_t>{}}, topo{std::vector<std::size_t>{}};
+    graph::dfs(g, FinishOnly{{}, &finish});
+    graph::topoSort(g, std::back_inserter(topo));
+
+    auto discover{std::vector<std::size_t>{}};
+    std::size_t treeEdges{0};
+    graph::dfs(g, DiscoverAndTree{{}, &discover, &treeEdges});
+
+    std::size_t overloadDiscoveries{0};
+    graph::dfs(g, UsingAndOverload{{}, &overloadDiscoveries});
+
+    std::cout << "\nResult:\n";
+    std::cout << "finish order " << (finish == fullFinish ? "equal" : "different")
+              << ", topoSort order " << (topo == fullFinish ? "equal" : "different")
+              << ", discoveries " << discover.size() << " of " << calls[2]
+              << ", tree edges " << treeEdges << " of " << calls[5]
+              << " (n - roots = " << n - calls[1] << ")\n";
+    std::cout << "discoveries through an overload next to the inherited hook "
+              << overloadDiscoveries << " of " << calls[2] << '\n';
+
+    bool ok{finish == fullFinish && topo == fullFinish && discover.size() == calls[2]
+            && treeEdges == calls[5] && treeEdges == n - calls[1] && calls[0] == n
+            && calls[4] == m && calls[4] == calls[8] && overloadDiscoveries == calls[2]};
+    return ok ? 0 : 1;
+}
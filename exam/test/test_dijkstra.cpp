@@ -0,0 +1,112 @@
+/**
+ * test_dijkstra.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of Dijkstra's algorithm using the example in Figure 24.6 from
+ * CLRS p. 659, and of repeated queries sharing a workspace on a random graph.
+ */
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/concepts.hpp>
+#include <graph/dijkstra.hpp>
+#include <graph/property_map.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Directed, graph::NoProp, double>;
+
+// O(V^2) Dijkstra without a heap, to compare against.
+std::vector<double> simpleDijkstra(const Graph &g, std::size_t s)
+{
+    auto n{numVertices(g)};
+    auto dist{std::vector<double>(n, graph::infiniteDistance<double>())};
+    auto done{std::vector<bool>(n)};
+    dist[s] = 0;
+    for (std::size_t k = 0; k < n; ++k) {
+        std::size_t u{n};
+        for (std::size_t v = 0; v < n; ++v) {
+            if (!done[v] && (u == n || dist[v] < dist[u])) {
+                u = v;
+            }
+        }
+        done[u] = true;
+        for (auto e : outEdges(u, g)) {
+            dist[target(e, g)] = std::min(dist[target(e, g)], dist[u] + g[e]);
+        }
+    }
+    return dist;
+}
+
+int main()
+{
+    // s=0, t=1, x=2, y=3, z=4
+    const char *names{"stxyz"};
+    auto g{Graph(5)};
+    addEdge(0, 1, 10.0, g);
+    addEdge(0, 3, 5.0, g);
+    addEdge(1, 2, 1.0, g);
+    addEdge(1, 3, 2.0, g);
+    addEdge(2, 4, 4.0, g);
+    addEdge(3, 1, 3.0, g);
+    addEdge(3, 2, 9.0, g);
+    addEdge(3, 4, 2.0, g);
+    addEdge(4, 0, 7.0, g);
+    addEdge(4, 2, 6.0, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of Dijkstra's algorithm\n";
+    std::cout << "using Figure 24.6 from CLRS p. 659 as an example, source s\n\n";
+    std::cout << "Expected distances and predecessors:\n";
+    std::cout << "s: 0 (s)  t: 8 (y)  x: 9 (t)  y: 5 (s)  z: 7 (y)\n";
+
+    auto dist{std::vector<double>(numVertices(g))};
+    auto pred{std::vector<std::size_t>(numVertices(g))};
+    graph::dijkstra(g, 0, graph::makeEdgePropMap(g),
+                    graph::makeIteratorVertexMap(dist.begin(), g),
+                    graph::makeIteratorVertexMap(pred.begin(), g));
+    std::cout << "\nResult:\n";
+    for (auto v : vertices(g)) {
+        std::cout << names[v] << ": " << dist[v] << " (" << names[pred[v]] << ")  ";
+    }
+    std::cout << '\n';
+    bool ok{dist == std::vector<double>{0, 8, 9, 5, 7}
+            && pred == std::vector<std::size_t>{0, 3, 1, 0, 3}};
+
+    std::cout << "\n100 queries sharing a workspace on a random graph\n";
+    std::cout << "with 2000 vertices and 10000 edges\n";
+    auto rg{Graph(2000)};
+    auto gen{std::mt19937(11)};
+    auto pick{std::uniform_int_distribution<std::size_t>(0, 1999)};
+    auto weight{std::uniform_real_distribution<double>(0.0, 100.0)};
+    for (auto [u, v] : test::randomEdges(gen, 2000, 10000)) {
+        addEdge(u, v, weight(gen), rg);
+    }
+    auto workspace{graph::DijkstraWorkspace<Graph, double>{}};
+    auto rdist{std::vector<double>(numVertices(rg))};
+    auto rpred{std::vector<std::size_t>(numVertices(rg))};
+    bool rok{true};
+    for (int q = 0; q < 100; ++q) {
+        auto s{pick(gen)};
+        graph::dijkstra(rg, s, graph::makeEdgePropMap(rg),
+                        graph::makeIteratorVertexMap(rdist.begin(), rg),
+                        graph::makeIteratorVertexMap(rpred.begin(), rg), workspace);
+        rok = rok && rdist == simpleDijkstra(rg, s);
+    }
+    std::cout << "All distances agree with a heap-less Dijkstra: " << (rok ? "yes" : "no") << '\n';
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok ? 0 : 1;
+}
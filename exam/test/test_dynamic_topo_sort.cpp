@@ -0,0 +1,132 @@
+/**
+ * test_dynamic_topo_sort.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of the topological order maintained under edge insertion, using the
+ * example in Figure 22.7 from CLRS p. 613 inserted edge by edge, and random
+ * insertions checked against the edges accepted so far.
+ */
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/concepts.hpp>
+#include <graph/depth_first_search.hpp>
+#include <graph/dynamic_topological_sort.hpp>
+#include <graph/tags.hpp>
+
+template<typename Order>
+bool isTopological(const Order &dto)
+{
+    const auto &g{dto.graph()};
+    for (auto e : edges(g)) {
+        if (dto.position(source(e, g)) >= dto.position(target(e, g))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Stops the search as soon as the target is discovered.
+struct FindVisitor : graph::DFSNullVisitor
+{
+    std::size_t target;
+    bool *found;
+
+    template<typename G, typename V>
+    graph::DFSControl discoverVertex(const V &v, const G &)
+    {
+        if (v == target) {
+            *found = true;
+            return graph::DFSControl::Stop;
+        }
+        return graph::DFSControl::Continue;
+    }
+};
+
+// Whether t can be reached from s in g.
+template<typename Graph>
+bool reaches(const Graph &g, std::size_t s, std::size_t t)
+{
+    bool found{false};
+    graph::dfs(g, s, FindVisitor{{}, t, &found});
+    return found;
+}
+
+int main()
+{
+    using Graph = graph::AdjacencyList<graph::tags::Bidirectional, std::string>;
+    auto dto{graph::DynamicTopoOrder<Graph>{}};
+
+    for (auto name : {"shirt", "tie", "jacket", "belt", "watch",
+                      "pants", "undershorts", "socks", "shoes"}) {
+        dto.addVertex(std::string{name});
+    }
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of the dynamic topological order\n";
+    std::cout << "using Figure 22.7 from CLRS p. 613 inserted edge by edge\n\n";
+
+    bool ok{true};
+    // inserted in the reverse order of the final topological order, so that
+    // most insertions have to reorder
+    for (auto [u, v] : std::vector<std::pair<std::size_t, std::size_t>>{
+            {7, 8}, {6, 8}, {6, 5}, {5, 8}, {5, 3}, {3, 2}, {1, 2}, {0, 3}, {0, 1}}) {
+        ok = ok && dto.addEdge(u, v).has_value() && isTopological(dto);
+    }
+    std::cout << "Order after all insertions:\n";
+    for (auto v : dto.order()) {
+        std::cout << v << ": " << dto.graph()[v] << "  ";
+    }
+    std::cout << '\n';
+
+    std::cout << "\nInserting jacket -> undershorts, which would close a cycle: ";
+    auto rejected{!dto.addEdge(2, 6).has_value()};
+    std::cout << (rejected ? "rejected" : "accepted") << '\n';
+    ok = ok && rejected && numEdges(dto.graph()) == 9;
+
+    std::cout << "\n5000 random insertions on 500 vertices\n";
+    auto rdto{graph::DynamicTopoOrder<graph::AdjacencyList<graph::tags::Bidirectional>>{}};
+    for (int i = 0; i < 500; ++i) {
+        rdto.addVertex();
+    }
+    auto gen{std::mt19937(7)};
+    auto pick{std::uniform_int_distribution<std::size_t>(0, 499)};
+    auto present{std::vector<bool>(500 * 500)};
+    std::size_t accepted{0}, rejections{0};
+    bool justified{true};
+    for (int i = 0; i < 5000; ++i) {
+        auto u{pick(gen)}, v{pick(gen)};
+        if (u == v || present[u * 500 + v]) {
+            continue;
+        }
+        if (rdto.addEdge(u, v)) {
+            present[u * 500 + v] = true;
+            ++accepted;
+        } else {
+            // a rejected edge must close a cycle, i.e. v already reaches u
+            justified = justified && reaches(rdto.graph(), v, u);
+            ++rejections;
+        }
+    }
+    auto rok{isTopological(rdto) && numEdges(rdto.graph()) == accepted};
+    std::cout << "Accepted " << accepted << " edges, order is topological: "
+              << (rok ? "yes" : "no") << '\n';
+    std::cout << "Rejected " << rejections << " edges, each closing a cycle: "
+              << (justified ? "yes" : "no") << '\n';
+    rok = rok && justified;
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok ? 0 : 1;
+}
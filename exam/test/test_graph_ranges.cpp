@@ -0,0 +1,116 @@
+/**
+ * test_graph_ranges.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of the vertex and edge ranges as C++20 ranges, splitting the edges of
+ * a graph between threads by position and filtering out-edges with std::views.
+ */
+#include <atomic>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/adjacency_matrix.hpp>
+#include <graph/parallel.hpp>
+#include <graph/static_graph.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+template<typename R>
+constexpr bool randomAccessView = std::ranges::random_access_range<R>
+        && std::ranges::sized_range<R> && std::ranges::borrowed_range<R>
+        && std::ranges::view<R>;
+
+using Graph = graph::AdjacencyList<graph::tags::Bidirectional,
+                                   graph::NoProp, int>;
+static_assert(randomAccessView<Graph::VertexRange>);
+static_assert(randomAccessView<Graph::EdgeRange>);
+static_assert(randomAccessView<Graph::OutEdgeRange>);
+static_assert(randomAccessView<Graph::InEdgeRange>);
+
+using Static = graph::StaticGraph<4, 3>;
+static_assert(randomAccessView<Static::VertexRange>);
+static_assert(randomAccessView<Static::EdgeRange>);
+
+// The edges of a matrix skip its empty entries, so they are only borrowed.
+using Matrix = graph::AdjacencyMatrix;
+static_assert(randomAccessView<Matrix::VertexRange>);
+static_assert(std::ranges::sized_range<Matrix::EdgeRange>);
+static_assert(std::ranges::borrowed_range<Matrix::OutEdgeRange>);
+
+int main()
+{
+    constexpr std::size_t n{20000}, m{100000};
+    auto gen{std::mt19937(7)};
+    auto weight{std::uniform_int_distribution<int>(1, 100)};
+    auto g{Graph(n)};
+    long expectedTotal{0};
+    for (auto [u, v] : test::randomEdges(gen, n, m)) {
+        auto w{weight(gen)};
+        expectedTotal += w;
+        addEdge(u, v, std::move(w), g);
+    }
+    // a hub with an out-edge to every odd vertex, in order
+    auto hub{addVertex(g)};
+    for (std::size_t v = 1; v < n; v += 2) {
+        addEdge(hub, v, 1, g);
+        expectedTotal += 1;
+    }
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of graph ranges on " << numVertices(g) << " vertices and "
+              << numEdges(g) << " edges\n\n";
+    std::cout << "Expected the total weight summed by 4 threads over parts of\n";
+    std::cout << "edges(g), the number of out-neighbours of the hub above " << n / 2
+              << "\nfound with std::views, and the middle and last out-neighbour\n";
+    std::cout << "of the hub found by position:\n";
+    std::cout << expectedTotal << ' ' << n / 4 << ' ' << n / 2 + 1 << ' '
+              << n - 1 << "\n\n";
+
+    // split edges(g) into chunks by position, as its iterators are random
+    // access, so dropping the edges before a chunk takes constant time
+    auto es{edges(g)};
+    std::atomic<long> total{0};
+    auto pool{graph::ThreadPool(4)};
+    auto sumChunk = [&](std::size_t, std::size_t first, std::size_t last) {
+        long sum{0};
+        auto chunk{es | std::views::drop(first) | std::views::take(last - first)};
+        for (const auto &e : chunk) {
+            sum += g[e];
+        }
+        total.fetch_add(sum, std::memory_order_relaxed);
+    };
+    graph::detail::parallelChunks(pool, es.size(), 4096, sumChunk);
+
+    // outEdges returns a view, so it composes without being stored first
+    auto isHigh = [&](const auto &e) { return target(e, g) > n / 2; };
+    auto highEdges{outEdges(hub, g) | std::views::filter(isHigh)};
+    auto high{std::ranges::distance(highEdges)};
+    // a borrowed range, so the iterator into the temporary range stays valid
+    auto middle{std::ranges::begin(outEdges(hub, g)) + outDegree(hub, g) / 2};
+    auto last{outEdges(hub, g)[outDegree(hub, g) - 1]};
+
+    std::cout << "Result:\n";
+    std::cout << total.load() << ' ' << high << ' ' << target(*middle, g) << ' '
+              << target(last, g) << '\n';
+
+    bool ok{total.load() == expectedTotal};
+    ok = ok && high == static_cast<std::ptrdiff_t>(n / 4);
+    ok = ok && target(*middle, g) == n / 2 + 1 && target(last, g) == n - 1;
+    return ok ? 0 : 1;
+}
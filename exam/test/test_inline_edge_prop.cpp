@@ -0,0 +1,114 @@
+/**
+ * test_inline_edge_prop.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of inline edge properties of AdjacencyList, used as the weights of
+ * Dijkstra's algorithm next to a string property in the edge list, and as the
+ * only edge property.
+ */
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/concepts.hpp>
+#include <graph/dijkstra.hpp>
+#include <graph/property_map.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Bidirectional, graph::NoProp, std::string, unsigned>;
+using PlainGraph = graph::AdjacencyList<graph::tags::Directed, graph::NoProp, unsigned>;
+using WeightGraph = graph::AdjacencyList<graph::tags::Directed, graph::NoProp, graph::NoProp, unsigned>;
+
+template<typename G, typename WeightMap>
+std::vector<unsigned> distances(const G &g, std::size_t s, WeightMap w)
+{
+    auto dist{std::vector<unsigned>(numVertices(g))};
+    auto pred{std::vector<std::size_t>(numVertices(g))};
+    graph::dijkstra(g, s, w, graph::makeIteratorVertexMap(dist.begin(), g),
+                    graph::makeIteratorVertexMap(pred.begin(), g));
+    return dist;
+}
+
+int main()
+{
+    static_assert(graph::BidirectionalGraph<Graph> && graph::MutablePropertyGraph<Graph>);
+    // without an inline property the descriptors do not grow
+    static_assert(sizeof(graph::AdjacencyList<graph::tags::Directed>::EdgeDescriptor)
+                  == 3 * sizeof(std::size_t));
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test: AdjacencyList<tags::Bidirectional, NoProp, std::string, unsigned>\n";
+    std::cout << "with the weights stored inline in the adjacency lists\n\n";
+
+    auto g{Graph(3)};
+    addEdge(0, 1, std::string{"a"}, 5u, g);
+    auto e12{addEdge(1, 2, std::string{"b"}, 7u, g)};
+    addEdge(0, 2, std::string{"c"}, 20u, g);
+    bool ok{true};
+    std::cout << "Out edges of 1: ";
+    for (auto e : outEdges(1, g)) {
+        std::cout << '(' << e.src << ',' << e.tar << ") '" << g[e] << "' " << inlineProp(e, g) << ' ';
+        ok = ok && g[e] == "b" && inlineProp(e, g) == 7u;
+    }
+    std::cout << "\nSetting the weight of (1,2) to 30\n";
+    setInlineProp(e12, 30u, g);
+    for (auto e : edges(g)) {
+        std::cout << '(' << e.src << ',' << e.tar << ") '" << g[e] << "' " << inlineProp(e, g) << "  ";
+    }
+    std::cout << '\n';
+    for (auto e : inEdges(2, g)) {
+        ok = ok && inlineProp(e, g) == (e.src == 1 ? 30u : 20u);
+    }
+    auto d{distances(g, 0, graph::makeInlineEdgePropMap(g))};
+    std::cout << "Distance from 0 to 2, expected 20: " << d[2] << '\n';
+    ok = ok && d[2] == 20u;
+
+    std::cout << "\nA graph with only inline weights, expected 2 -> 0 weight 4, 2 -> 1 weight 9\n";
+    auto wg{WeightGraph(3)};
+    addEdge(2, 0, 4u, wg);
+    addEdge(2, 1, graph::NoProp{}, 9u, wg);
+    for (auto e : outEdges(2, wg)) {
+        std::cout << e.src << " -> " << e.tar << " weight " << inlineProp(e, wg) << "  ";
+        ok = ok && inlineProp(e, wg) == (e.tar == 0 ? 4u : 9u);
+    }
+    std::cout << '\n';
+
+    std::cout << "\nRandom graphs with 5000 vertices and 25000 edges\n";
+    auto rg{Graph(5000)};
+    auto pg{PlainGraph(5000)};
+    auto rwg{WeightGraph(5000)};
+    auto gen{std::mt19937(17)};
+    auto weight{std::uniform_int_distribution<unsigned>(1, 100)};
+    std::size_t id{0};
+    for (auto [u, v] : test::randomEdges(gen, 5000, 25000)) {
+        auto w{weight(gen)};
+        addEdge(u, v, std::to_string(++id), w, rg);
+        addEdge(u, v, w, rwg);
+        addEdge(u, v, std::move(w), pg);
+    }
+    auto expected{distances(pg, 0, graph::makeEdgePropMap(pg))};
+    auto rok{distances(rg, 0, graph::makeInlineEdgePropMap(rg)) == expected};
+    std::cout << "Distances with inline weights agree with edge list weights: "
+              << (rok ? "yes" : "no") << '\n';
+    auto wok{distances(rwg, 0, graph::makeInlineEdgePropMap(rwg)) == expected};
+    std::cout << "Distances with only inline weights agree with edge list weights: "
+              << (wok ? "yes" : "no") << '\n';
+    rok = rok && wok;
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+/**
+ * test_lazy_traversal.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of the lazy traversal ranges against the visitor-based searches, and of
+ * reading only a prefix of a traversal of a large graph.
+ */
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/breadth_first_search.hpp>
+#include <graph/depth_first_search.hpp>
+#include <graph/lazy_traversal.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Directed>;
+
+static_assert(std::ranges::input_range<graph::Generator<std::size_t>>);
+static_assert(std::ranges::view<graph::Generator<std::size_t>>);
+
+struct OrderVisitor : graph::DFSNullVisitor
+{
+    std::vector<std::size_t> *pre, *post;
+
+    void discoverVertex(std::size_t v, const Graph &) { pre->push_back(v); }
+    void finishVertex(std::size_t v, const Graph &) { post->push_back(v); }
+};
+
+struct BFSOrderVisitor : graph::BFSNullVisitor
+{
+    std::vector<std::size_t> *order;
+
+    void discoverVertex(std::size_t v, const Graph &) { order->push_back(v); }
+};
+
+template<typename Range>
+std::vector<std::size_t> collect(Range &&r)
+{
+    auto out{std::vector<std::size_t>{}};
+    for (auto v : r) {
+        out.push_back(v);
+    }
+    return out;
+}
+
+void print(const std::vector<std::size_t> &vs)
+{
+    for (auto v : vs) {
+        std::cout << v << ' ';
+    }
+    std::cout << '\n';
+}
+
+int main()
+{
+    auto g{Graph(7)};
+    addEdge(0, 1, g);
+    addEdge(0, 2, g);
+    addEdge(1, 3, g);
+    addEdge(1, 4, g);
+    addEdge(2, 4, g);
+    addEdge(4, 0, g);
+    addEdge(5, 6, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of lazy traversal ranges from vertex 0\n";
+    std::cout << "edges 0-1 0-2 1-3 1-4 2-4 4-0 5-6\n\n";
+    std::cout << "Expected preorder, postorder, breadth-first order, and the first two\n"
+                 "even vertices in preorder:\n";
+    std::cout << "0 1 3 4 2 \n3 4 1 2 0 \n0 1 2 3 4 \n0 4 \n";
+
+    bool ok{true};
+    auto pre{collect(graph::dfsPreorder(g, 0))};
+    auto post{collect(graph::dfsPostorder(g, 0))};
+    auto breadth{collect(graph::bfsOrder(g, 0))};
+    auto even{collect(graph::dfsPreorder(g, 0)
+                      | std::views::filter([](std::size_t v) { return v % 2 == 0; })
+                      | std::views::take(2))};
+    std::cout << "\nResult:\n";
+    print(pre);
+    print(post);
+    print(breadth);
+    print(even);
+    ok = ok && pre == std::vector<std::size_t>{0, 1, 3, 4, 2};
+    ok = ok && post == std::vector<std::size_t>{3, 4, 1, 2, 0};
+    ok = ok && breadth == std::vector<std::size_t>{0, 1, 2, 3, 4};
+    ok = ok && even == std::vector<std::size_t>{0, 4};
+
+    auto rng{std::mt19937(42)};
+    auto randomGraph = [&](std::size_t n, std::size_t m) {
+        auto r{Graph(n)};
+        for (auto [u, v] : test::randomEdges(rng, n, m)) {
+            addEdge(u, v, r);
+        }
+        return r;
+    };
+
+    // small enough for the recursion of dfs
+    auto small{randomGraph(2000, 6000)};
+    auto large{randomGraph(200000, 800000)};
+    const std::size_t queries{200};
+    std::cout << "\nRandom graphs with 2000 vertices and 6000 edges, and 200000 vertices and\n"
+                 "800000 edges\n";
+    std::cout << "Expected: full orders of the small graph equal to the visitor-based searches,\n"
+              << "and " << queries << " pages of 20 vertices of the large graph read from a shared\n"
+                 "workspace equal to the start of a full traversal\n";
+    std::size_t mismatches{0};
+    for (std::size_t s = 0; s < 20; ++s) {
+        auto dfsPre{std::vector<std::size_t>{}}, dfsPost{std::vector<std::size_t>{}};
+        auto bfsDiscover{std::vector<std::size_t>{}};
+        graph::dfs(small, s, OrderVisitor{{}, &dfsPre, &dfsPost});
+        graph::bfs(small, s, BFSOrderVisitor{{}, &bfsDiscover});
+        mismatches += collect(graph::dfsPreorder(small, s)) != dfsPre;
+        mismatches += collect(graph::dfsPostorder(small, s)) != dfsPost;
+        mismatches += collect(graph::bfsOrder(small, s)) != bfsDiscover;
+    }
+    auto workspace{graph::TraversalWorkspace<Graph>(large)};
+    auto vertex{std::uniform_int_distribution<std::size_t>(0, numVertices(large) - 1)};
+    for (std::size_t q = 0; q < queries; ++q) {
+        auto s{vertex(rng)};
+        auto page{collect(graph::bfsOrder(large, s, workspace) | std::views::take(20))};
+        if (q % 100 == 0) {
+            auto full{collect(graph::bfsOrder(large, s))};
+            full.resize(std::min<std::size_t>(full.size(), 20));
+            mismatches += page != full;
+            page = collect(graph::dfsPreorder(large, s, workspace) | std::views::take(20));
+            full = collect(graph::dfsPreorder(large, s));
+            full.resize(std::min<std::size_t>(full.size(), 20));
+            mismatches += page != full;
+        }
+    }
+    std::cout << "Result: " << mismatches << " mismatches\n";
+    ok = ok && mismatches == 0;
+
+    return ok ? 0 : 1;
+}
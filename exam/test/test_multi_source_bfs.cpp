@@ -0,0 +1,153 @@
+/**
+ * test_multi_source_bfs.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of the multi-source breadth-first search on the example in
+ * Figure 22.3 from CLRS p. 596, and on a random graph compared against a
+ * search per source.
+ */
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/multi_source_bfs.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Directed>;
+
+constexpr auto unreachable{std::numeric_limits<std::size_t>::max()};
+
+std::vector<std::size_t> distancesFrom(const Graph &g, std::size_t s)
+{
+    auto dist{std::vector<std::size_t>(numVertices(g), unreachable)};
+    auto q{std::queue<std::size_t>{}};
+    dist[s] = 0;
+    q.push(s);
+    while (!q.empty()) {
+        auto u{q.front()};
+        q.pop();
+        for (auto e : outEdges(u, g)) {
+            if (dist[target(e, g)] == unreachable) {
+                dist[target(e, g)] = dist[u] + 1;
+                q.push(target(e, g));
+            }
+        }
+    }
+    return dist;
+}
+
+// The distances from every source, computed by one multi-source search.
+template<std::size_t Width>
+std::vector<std::vector<std::size_t>> batchDistances(const Graph &g,
+                                                     const std::vector<std::size_t> &sources)
+{
+    auto dist{std::vector<std::vector<std::size_t>>(
+        sources.size(), std::vector<std::size_t>(numVertices(g), unreachable))};
+    graph::multiSourceBfs<Width>(g, sources, [&](std::size_t v, std::size_t d,
+                                                 const graph::SourceMask<Width> &mask) {
+        mask.forEach([&](std::size_t i) {
+            dist[i][v] = d;
+        });
+    });
+    return dist;
+}
+
+int main()
+{
+    // The undirected graph of Figure 22.3 with both directions of every edge:
+    // r=0, s=1, t=2, u=3, v=4, w=5, x=6, y=7
+    auto g{Graph(8)};
+    auto addBoth = [&g](std::size_t u, std::size_t v) {
+        addEdge(u, v, g);
+        addEdge(v, u, g);
+    };
+    addBoth(0, 1);
+    addBoth(0, 4);
+    addBoth(1, 5);
+    addBoth(5, 2);
+    addBoth(5, 6);
+    addBoth(2, 6);
+    addBoth(2, 3);
+    addBoth(6, 3);
+    addBoth(6, 7);
+    addBoth(3, 7);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of multi-source breadth-first search\n";
+    std::cout << "using Figure 22.3 from CLRS p. 596 as an example, all 8 sources at once\n\n";
+
+    std::cout << "Expected eccentricity and total distance per source:\n";
+    std::cout << "0: 4 18  1: 3 14  2: 4 14  3: 5 17  4: 5 24  5: 3 12  6: 4 13  7: 5 18\n";
+
+    auto all{std::vector<std::size_t>{0, 1, 2, 3, 4, 5, 6, 7}};
+    auto stats{graph::multiSourceBfsStats<64>(g, all)};
+    std::cout << "\nResult:\n";
+    for (auto v : all) {
+        std::cout << v << ": " << stats.eccentricity[v] << ' ' << stats.totalDistance[v] << "  ";
+    }
+    std::cout << '\n';
+    bool ok{stats.eccentricity == std::vector<std::size_t>{4, 3, 4, 5, 5, 3, 4, 5}
+            && stats.totalDistance == std::vector<std::uint64_t>{18, 14, 14, 17, 24, 12, 13, 18}
+            && stats.reached == std::vector<std::size_t>(8, 8)};
+
+    std::cout << "\nRandom graph with 20000 vertices and 60000 edges, 300 sources\n";
+    const std::size_t n{20000};
+    auto rg{Graph(n)};
+    auto gen{std::mt19937(42)};
+    auto pick{std::uniform_int_distribution<std::size_t>(0, n - 1)};
+    for (auto [u, v] : test::randomEdges(gen, n, 60000)) {
+        addEdge(u, v, rg);
+    }
+    auto sources{std::vector<std::size_t>(300)};
+    for (auto &s : sources) {
+        s = pick(gen);
+    }
+    sources[1] = sources[0]; // a repeated source
+
+    auto expected{std::vector<std::vector<std::size_t>>{}};
+    auto expectedStats{graph::MultiSourceBfsStats{}};
+    for (auto s : sources) {
+        expected.push_back(distancesFrom(rg, s));
+        std::size_t reached{0}, eccentricity{0};
+        std::uint64_t total{0};
+        for (auto d : expected.back()) {
+            if (d != unreachable) {
+                ++reached;
+                eccentricity = std::max(eccentricity, d);
+                total += d;
+            }
+        }
+        expectedStats.reached.push_back(reached);
+        expectedStats.eccentricity.push_back(eccentricity);
+        expectedStats.totalDistance.push_back(total);
+    }
+    auto first64{std::vector<std::size_t>(sources.begin(), sources.begin() + 64)};
+    auto first256{std::vector<std::size_t>(sources.begin(), sources.begin() + 256)};
+    bool rok{batchDistances<64>(rg, first64)
+                 == std::vector<std::vector<std::size_t>>(expected.begin(), expected.begin() + 64)
+             && batchDistances<256>(rg, first256)
+                 == std::vector<std::vector<std::size_t>>(expected.begin(), expected.begin() + 256)};
+    auto rstats{graph::multiSourceBfsStats(rg, sources)};
+    rok = rok && rstats.reached == expectedStats.reached
+              && rstats.eccentricity == expectedStats.eccentricity
+              && rstats.totalDistance == expectedStats.totalDistance;
+    std::cout << "Distances in batches of 64 and 256, and the statistics of all sources,\n"
+                 "agree with a search per source: " << (rok ? "yes" : "no") << '\n';
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok ? 0 : 1;
+}
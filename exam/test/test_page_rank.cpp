@@ -0,0 +1,121 @@
+/**
+ * test_page_rank.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of PageRank against a straightforward sequential push-based power
+ * iteration, with and without personalization.
+ */
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/concepts.hpp>
+#include <graph/page_rank.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Bidirectional>;
+
+std::vector<double> referenceRank(const Graph &g, std::vector<double> teleport, std::size_t iterations)
+{
+    auto n{numVertices(g)};
+    auto rank{teleport};
+    for (std::size_t it = 0; it < iterations; ++it) {
+        auto next{std::vector<double>(n, 0.0)};
+        double dangling{0};
+        for (auto u : vertices(g)) {
+            if (outDegree(u, g) == 0) {
+                dangling += rank[u];
+            }
+            for (auto e : outEdges(u, g)) {
+                next[target(e, g)] += 0.85 * rank[u] / outDegree(u, g);
+            }
+        }
+        for (auto v : vertices(g)) {
+            next[v] += (0.15 + 0.85 * dangling) * teleport[v];
+        }
+        rank = next;
+    }
+    return rank;
+}
+
+double maxDifference(const std::vector<double> &a, const std::vector<double> &b)
+{
+    double diff{0};
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        diff = std::max(diff, std::abs(a[i] - b[i]));
+    }
+    return diff;
+}
+
+int main()
+{
+    // a small web: 0 <-> 1, 1 -> 2, 2 -> 0, 3 -> 2, and 4 without out-edges
+    auto g{Graph(5)};
+    addEdge(0, 1, g);
+    addEdge(1, 0, g);
+    addEdge(1, 2, g);
+    addEdge(2, 0, g);
+    addEdge(3, 2, g);
+    addEdge(3, 4, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of PageRank, 4 threads\n\n";
+
+    auto options{graph::PageRankOptions{}};
+    options.policy = graph::execution::Parallel{4};
+    auto res{graph::pageRank(g, options)};
+    auto expected{referenceRank(g, std::vector<double>(5, 0.2), 1000)};
+    std::cout << "Expected ranks:\n" << std::setprecision(6) << std::fixed;
+    for (auto r : expected) {
+        std::cout << r << "  ";
+    }
+    std::cout << "\nResult after " << res.iterations << " iterations:\n";
+    for (auto r : res.rank) {
+        std::cout << r << "  ";
+    }
+    std::cout << '\n';
+    bool ok{res.converged && maxDifference(res.rank, expected) < 1e-8};
+
+    std::cout << "\nPersonalized to vertex 3:\n";
+    options.personalization = {0, 0, 0, 2, 0};
+    auto pres{graph::pageRank(g, options)};
+    auto pexpected{referenceRank(g, {0, 0, 0, 1, 0}, 1000)};
+    for (auto r : pres.rank) {
+        std::cout << r << "  ";
+    }
+    std::cout << '\n';
+    ok = ok && pres.converged && maxDifference(pres.rank, pexpected) < 1e-8;
+
+    std::cout << "\nRandom graph with 50000 vertices and 400000 edges\n";
+    auto rg{Graph(50000)};
+    auto gen{std::mt19937(31)};
+    for (auto [u, v] : test::randomEdges(gen, 50000, 400000)) {
+        addEdge(u, v, rg);
+    }
+    options.personalization.clear();
+    auto rres{graph::pageRank(rg, options)};
+    auto rexpected{referenceRank(rg, std::vector<double>(50000, 1.0 / 50000), rres.iterations)};
+    double total{0};
+    for (auto r : rres.rank) {
+        total += r;
+    }
+    auto rok{maxDifference(rres.rank, rexpected) < 1e-12 && std::abs(total - 1.0) < 1e-9};
+    std::cout << "Converged after " << rres.iterations << " iterations, agrees with the reference: "
+              << (rok ? "yes" : "no") << '\n';
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok ? 0 : 1;
+}
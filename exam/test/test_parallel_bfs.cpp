@@ -0,0 +1,120 @@
+/**
+ * test_parallel_bfs.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of the parallel breadth-first search using the example in
+ * Figure 22.3 from CLRS p. 596, and a larger random graph compared
+ * against a sequential search.
+ */
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/breadth_first_search.hpp>
+#include <graph/concepts.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Directed>;
+
+std::vector<std::size_t> sequentialDistances(const Graph &g, std::size_t s)
+{
+    auto dist{std::vector<std::size_t>(numVertices(g), graph::BFSResult<Graph>::unreachable)};
+    auto q{std::queue<std::size_t>{}};
+    dist[s] = 0;
+    q.push(s);
+    while (!q.empty()) {
+        auto u{q.front()};
+        q.pop();
+        for (auto e : outEdges(u, g)) {
+            if (dist[target(e, g)] == graph::BFSResult<Graph>::unreachable) {
+                dist[target(e, g)] = dist[u] + 1;
+                q.push(target(e, g));
+            }
+        }
+    }
+    return dist;
+}
+
+int main()
+{
+    // The undirected graph of Figure 22.3 with both directions of every edge:
+    // r=0, s=1, t=2, u=3, v=4, w=5, x=6, y=7
+    auto g{Graph(8)};
+    auto addBoth = [&g](std::size_t u, std::size_t v) {
+        addEdge(u, v, g);
+        addEdge(v, u, g);
+    };
+    addBoth(0, 1);
+    addBoth(0, 4);
+    addBoth(1, 5);
+    addBoth(5, 2);
+    addBoth(5, 6);
+    addBoth(2, 6);
+    addBoth(2, 3);
+    addBoth(6, 3);
+    addBoth(6, 7);
+    addBoth(3, 7);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of parallel breadth-first search\n";
+    std::cout << "using Figure 22.3 from CLRS p. 596 as an example, source s = 1\n\n";
+
+    std::cout << "Expected distances:\n";
+    std::cout << "0: 1  1: 0  2: 2  3: 3  4: 2  5: 1  6: 2  7: 3\n";
+
+    auto res{graph::parallelBfs(g, 1, graph::execution::Parallel{4})};
+    std::cout << "\nResult:\n";
+    for (auto v : vertices(g)) {
+        std::cout << v << ": " << res.distance[v] << "  ";
+    }
+    std::cout << '\n';
+
+    bool ok{res.distance == sequentialDistances(g, 1)};
+    for (auto v : vertices(g)) {
+        if (v != 1 && res.distance[res.parent[v]] + 1 != res.distance[v]) {
+            ok = false;
+        }
+    }
+
+    std::cout << "\nRandom graph with 20000 vertices and 100000 edges, 4 threads\n";
+    auto rg{Graph(20000)};
+    auto gen{std::mt19937(42)};
+    for (auto [u, v] : test::randomEdges(gen, 20000, 100000)) {
+        addEdge(u, v, rg);
+    }
+    auto rres{graph::parallelBfs(rg, 0, graph::execution::Parallel{4})};
+    bool rok{rres.distance == sequentialDistances(rg, 0)};
+    for (auto v : vertices(rg)) {
+        if (v != 0 && rres.distance[v] != graph::BFSResult<Graph>::unreachable
+                && rres.distance[rres.parent[v]] + 1 != rres.distance[v]) {
+            rok = false;
+        }
+    }
+    std::cout << "Distances and parents agree with a sequential search: "
+              << (rok ? "yes" : "no") << '\n';
+
+    // repeated searches from other sources on one pool, reusing its threads
+    auto pool{graph::ThreadPool(4)};
+    bool pok{true};
+    for (std::size_t s = 1; s <= 20; ++s) {
+        pok = pok && graph::parallelBfs(rg, s, pool).distance == sequentialDistances(rg, s);
+    }
+    std::cout << "20 searches on a shared pool agree with a sequential search: "
+              << (pok ? "yes" : "no") << '\n';
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok && pok ? 0 : 1;
+}
@@ -0,0 +1,165 @@
+/**
+ * test_property_map.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of the property maps: the property map concepts, Dijkstra's algorithm
+ * reading weights from a member of the edge properties, a packed map of bits,
+ * and depth-first search with its colours in a packed map.
+ */
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/depth_first_search.hpp>
+#include <graph/dijkstra.hpp>
+#include <graph/property_map.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+struct City
+{
+    std::string name;
+    double distance;
+};
+
+struct Road
+{
+    int id;
+    double length;
+};
+
+using Graph = graph::AdjacencyList<graph::tags::Directed, City, Road>;
+using Plain = graph::AdjacencyList<graph::tags::Directed>;
+using V = Graph::VertexDescriptor;
+using E = Graph::EdgeDescriptor;
+
+using IteratorMap = graph::IteratorVertexMap<Graph, std::vector<int>::iterator>;
+using VectorMap = graph::VectorVertexMap<Graph, double>;
+using BitMap = graph::PackedVertexMap<Graph>;
+using ColourMap = graph::PackedVertexMap<Plain, graph::DFSColour, 2>;
+using NameMap = graph::MemberPropertyMap<Graph, V, City, std::string>;
+using ConstLengthMap = graph::MemberPropertyMap<const Graph, E, Road, double>;
+
+static_assert(graph::ReadWritePropertyMap<IteratorMap, V, int>);
+static_assert(graph::ReadWritePropertyMap<VectorMap, V, double>);
+static_assert(graph::ReadWritePropertyMap<BitMap, V, bool>);
+static_assert(graph::ReadWritePropertyMap<ColourMap, Plain::VertexDescriptor, graph::DFSColour>);
+static_assert(graph::ReadWritePropertyMap<NameMap, V, std::string>);
+static_assert(graph::ReadablePropertyMap<ConstLengthMap, E>);
+static_assert(!graph::WritablePropertyMap<ConstLengthMap, E, double>);
+static_assert(graph::ReadablePropertyMap<graph::EdgePropMap<Graph>, E>);
+static_assert(!graph::WritablePropertyMap<graph::EdgePropMap<Graph>, E, Road>);
+// signed values would not read back, as the bits are not sign extended
+template<typename T>
+concept Packable = requires { typename graph::PackedVertexMap<Plain, T, 4>; };
+static_assert(Packable<unsigned> && Packable<bool> && Packable<graph::DFSColour>);
+static_assert(!Packable<int>);
+
+// Records the discovery order.
+struct DiscoverVisitor : graph::DFSNullVisitor
+{
+    std::vector<std::size_t> *order;
+
+    void discoverVertex(std::size_t v, const Plain &) { order->push_back(v); }
+};
+
+int main()
+{
+    auto g{Graph{}};
+    for (auto name : {"Odense", "Vejle", "Aarhus", "Aalborg"}) {
+        addVertex(City{name, 0}, g);
+    }
+    addEdge(0, 1, Road{1, 76}, g);
+    addEdge(1, 2, Road{2, 73}, g);
+    addEdge(0, 2, Road{3, 160}, g);
+    addEdge(2, 3, Road{4, 118}, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of property maps\n";
+    std::cout << "Dijkstra from Odense reading Road::length and writing City::distance\n\n";
+    std::cout << "Expected distances and predecessors:\n";
+    std::cout << "Odense 0 (Odense)  Vejle 76 (Odense)  Aarhus 149 (Vejle)  Aalborg 267 (Aarhus)  \n";
+
+    const auto &cg{g};
+    auto pred{graph::makeVectorVertexMap<V>(g)};
+    graph::dijkstra(cg, 0, graph::makeEdgeMemberMap(cg, &Road::length),
+                    graph::makeVertexMemberMap(g, &City::distance), pred);
+    auto names{graph::makeVertexMemberMap(cg, &City::name)};
+    std::cout << "\nResult:\n";
+    bool ok{true};
+    for (auto v : vertices(g)) {
+        std::cout << get(names, v) << ' ' << g[v].distance << " (" << get(names, get(pred, v))
+                  << ")  ";
+    }
+    std::cout << '\n';
+    ok = ok && g[1].distance == 76 && g[2].distance == 149 && g[3].distance == 267
+         && pred.values() == std::vector<V>{0, 0, 1, 2};
+
+    const std::size_t n{10000};
+    auto rng{std::mt19937(42)};
+    auto vertex{std::uniform_int_distribution<std::size_t>(0, n - 1)};
+    auto r{Plain(n)};
+    for (auto [u, v] : test::randomEdges(rng, n, 3 * n)) {
+        addEdge(u, v, r);
+    }
+
+    std::cout << "\nRandom graph with " << n << " vertices and " << 3 * n << " edges\n";
+    std::cout << "Expected: a bit map of " << (n + 63) / 64 * 8 << " bytes agreeing with a "
+                 "std::vector<bool>,\nthe same discovery order with a colour map of "
+              << (n + 31) / 32 * 8 << " bytes as with a workspace,\nall vertices black "
+                 "afterwards, and searches from every vertex sharing a\ncolour map visiting "
+                 "each vertex once\n";
+    auto bits{graph::makePackedVertexMap(r)};
+    auto reference{std::vector<bool>(n)};
+    std::size_t mismatches{0};
+    for (std::size_t i = 0; i < n; ++i) {
+        auto v{vertex(rng)};
+        bool b{i % 3 != 0};
+        put(bits, v, b);
+        reference[v] = b;
+    }
+    for (std::size_t v = 0; v < n; ++v) {
+        mismatches += get(bits, v) != reference[v];
+    }
+
+    auto withWorkspace{std::vector<std::size_t>{}}, withMap{std::vector<std::size_t>{}};
+    auto colours{graph::makePackedVertexMap<graph::DFSColour, 2>(r, graph::DFSColour::Grey)};
+    graph::dfs(r, DiscoverVisitor{{}, &withWorkspace});
+    graph::dfs(r, DiscoverVisitor{{}, &withMap}, colours);
+    mismatches += withMap != withWorkspace;
+    for (std::size_t v = 0; v < n; ++v) {
+        mismatches += get(colours, v) != graph::DFSColour::Black;
+    }
+
+    auto shared{graph::makeVectorVertexMap(r, graph::DFSColour::White)};
+    auto visits{std::vector<std::size_t>{}};
+    for (std::size_t v = 0; v < n; ++v) {
+        if (get(shared, v) == graph::DFSColour::White) {
+            graph::dfs(r, v, DiscoverVisitor{{}, &visits}, shared);
+        }
+    }
+    std::sort(visits.begin(), visits.end());
+    for (std::size_t v = 0; v < n; ++v) {
+        mismatches += visits.size() != n || visits[v] != v;
+    }
+
+    std::cout << "Result: " << mismatches << " mismatches, " << bits.bytes() << " and "
+              << colours.bytes() << " bytes\n";
+    ok = ok && mismatches == 0 && bits.bytes() == (n + 63) / 64 * 8
+         && colours.bytes() == (n + 31) / 32 * 8;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,129 @@
+/**
+ * test_reachability.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of the reachability index on the DAG of Figure 22.7 from CLRS p. 613,
+ * and on a random DAG compared against a search per source.
+ */
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/reachability.hpp>
+#include <graph/tags.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Directed>;
+
+std::vector<bool> reachableFrom(const Graph &g, std::size_t s)
+{
+    auto seen{std::vector<bool>(numVertices(g), false)};
+    auto stack{std::vector<std::size_t>{s}};
+    seen[s] = true;
+    while (!stack.empty()) {
+        auto u{stack.back()};
+        stack.pop_back();
+        for (auto e : outEdges(u, g)) {
+            if (!seen[target(e, g)]) {
+                seen[target(e, g)] = true;
+                stack.push_back(target(e, g));
+            }
+        }
+    }
+    return seen;
+}
+
+int main()
+{
+    // Professor Bumstead's clothes: undershorts=0, pants=1, belt=2, shirt=3,
+    // tie=4, jacket=5, socks=6, shoes=7, watch=8
+    auto g{Graph(9)};
+    addEdge(0, 1, g);
+    addEdge(0, 7, g);
+    addEdge(1, 2, g);
+    addEdge(1, 7, g);
+    addEdge(2, 5, g);
+    addEdge(3, 2, g);
+    addEdge(3, 4, g);
+    addEdge(4, 5, g);
+    addEdge(6, 7, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of the reachability index\n";
+    std::cout << "using Figure 22.7 from CLRS p. 613 as an example\n\n";
+
+    std::cout << "Expected reaches(undershorts, jacket), reaches(shirt, jacket),\n"
+                 "reaches(socks, pants), reaches(watch, watch), reaches(jacket, belt):\n";
+    std::cout << "1 1 0 1 0\n";
+
+    auto index{graph::ReachabilityIndex<Graph>(g)};
+    std::cout << "\nResult:\n";
+    std::cout << index.reaches(0, 5) << ' ' << index.reaches(3, 5) << ' '
+              << index.reaches(6, 1) << ' ' << index.reaches(8, 8) << ' '
+              << index.reaches(5, 2) << '\n';
+    bool ok{true};
+    for (std::size_t u = 0; u < 9; ++u) {
+        auto expected{reachableFrom(g, u)};
+        for (std::size_t v = 0; v < 9; ++v) {
+            ok = ok && index.reaches(u, v) == expected[v];
+        }
+    }
+
+    std::cout << "\nRandom DAG with 3000 vertices and 6000 edges, all pairs\n";
+    const std::size_t n{3000};
+    auto rg{Graph(n)};
+    auto rank{std::vector<std::size_t>(n)};
+    std::iota(rank.begin(), rank.end(), std::size_t{0});
+    auto gen{std::mt19937(42)};
+    std::shuffle(rank.begin(), rank.end(), gen);
+    // distinct unordered pairs, oriented by rank
+    for (auto [u, v] : test::randomDagEdges(gen, n, 6000)) {
+        if (rank[u] < rank[v]) {
+            addEdge(u, v, rg);
+        } else {
+            addEdge(v, u, rg);
+        }
+    }
+    auto rindex{graph::ReachabilityIndex<Graph>(rg, 4)};
+    auto workspace{graph::ReachabilityWorkspace{}};
+    bool rok{true};
+    std::size_t positive{0};
+    for (std::size_t u = 0; u < n; ++u) {
+        auto expected{reachableFrom(rg, u)};
+        for (std::size_t v = 0; v < n; ++v) {
+            rok = rok && rindex.reaches(u, v, workspace) == expected[v];
+            positive += expected[v];
+        }
+    }
+    std::cout << "Answers (" << positive << " reachable pairs) agree with a search per source: "
+              << (rok ? "yes" : "no") << '\n';
+
+    auto cyclic{Graph(3)};
+    addEdge(0, 1, cyclic);
+    addEdge(1, 2, cyclic);
+    addEdge(2, 0, cyclic);
+    bool thrown{false};
+    try {
+        graph::ReachabilityIndex<Graph>{cyclic};
+    } catch (const graph::NotADagError &) {
+        thrown = true;
+    }
+    std::cout << "Building an index of a cyclic graph throws NotADagError: "
+              << (thrown ? "yes" : "no") << '\n';
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok && thrown ? 0 : 1;
+}
@@ -0,0 +1,156 @@
+/**
+ * test_resumable_traversal.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of depth-first search and topological sorting in slices, comparing the
+ * hooks called for several budgets against a single call of dfs.
+ */
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/depth_first_search.hpp>
+#include <graph/resumable_traversal.hpp>
+#include <graph/tags.hpp>
+#include <graph/topological_sort.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Directed>;
+using Event = std::tuple<char, std::size_t, std::size_t>;
+
+// Records every hook as (kind, vertex) or (kind, source, target). Vertex
+// stopAt stops the search when discovered, and vertex pruneAt is not explored.
+struct RecordingVisitor
+{
+    std::vector<Event> *log;
+    std::size_t stopAt = -1, pruneAt = -1;
+
+    void initVertex(std::size_t v, const Graph &) { log->emplace_back('i', v, 0); }
+    void startVertex(std::size_t v, const Graph &) { log->emplace_back('s', v, 0); }
+    graph::DFSControl discoverVertex(std::size_t v, const Graph &)
+    {
+        log->emplace_back('d', v, 0);
+        return v == stopAt ? graph::DFSControl::Stop
+                           : v == pruneAt ? graph::DFSControl::Prune : graph::DFSControl::Continue;
+    }
+    void finishVertex(std::size_t v, const Graph &) { log->emplace_back('f', v, 0); }
+
+    template<typename E>
+    void record(char kind, const E &e, const Graph &g)
+    {
+        log->emplace_back(kind, source(e, g), target(e, g));
+    }
+
+    template<typename E> void examineEdge(const E &e, const Graph &g) { record('x', e, g); }
+    template<typename E> void treeEdge(const E &e, const Graph &g) { record('t', e, g); }
+    template<typename E> void backEdge(const E &e, const Graph &g) { record('b', e, g); }
+    template<typename E> void forwardOrCrossEdge(const E &e, const Graph &g) { record('c', e, g); }
+    template<typename E> void finishEdge(const E &e, const Graph &g) { record('e', e, g); }
+};
+
+Graph randomGraph(std::mt19937 &rng, std::size_t n, std::size_t m, bool acyclic)
+{
+    auto g{Graph(n)};
+    auto edges{acyclic ? test::randomDagEdges(rng, n, m) : test::randomEdges(rng, n, m)};
+    for (auto [u, v] : edges) {
+        addEdge(u, v, g);
+    }
+    return g;
+}
+
+// Runs search to the end in slices of the given budget, returning the number
+// of slices.
+template<typename Search>
+std::size_t runInSlices(Search &search, graph::TraversalBudget budget)
+{
+    std::size_t slices{1};
+    while (!search.advance(budget)) {
+        ++slices;
+    }
+    return slices;
+}
+
+int main()
+{
+    auto g{Graph(6)};
+    addEdge(0, 1, g);
+    addEdge(0, 2, g);
+    addEdge(1, 2, g);
+    addEdge(2, 0, g);
+    addEdge(3, 2, g);
+    addEdge(4, 5, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of resumable depth-first search\n";
+    std::cout << "edges 0-1 0-2 1-2 2-0 3-2 4-5, advanced 5 steps at a time\n\n";
+    std::cout << "Expected slices, edges examined after the first two slices, and at the end:\n";
+    std::cout << "5 3 6\n";
+
+    bool ok{true};
+    auto expected{std::vector<Event>{}}, log{std::vector<Event>{}};
+    graph::dfs(g, RecordingVisitor{&expected});
+    auto search{graph::ResumableDFS(g, RecordingVisitor{&log})};
+    search.advance({5});
+    search.advance({5});
+    auto early{search.edgesExamined()};
+    auto slices{2 + runInSlices(search, {5})};
+    std::cout << "\nResult:\n" << slices << ' ' << early << ' ' << search.edgesExamined() << '\n';
+    ok = ok && slices == 5 && early == 3 && search.edgesExamined() == 6 && log == expected;
+
+    auto rng{std::mt19937(42)};
+    std::cout << "\nRandom graphs with 2000 vertices and 8000 edges\n";
+    std::cout << "Expected: the same hooks as dfs for whole and rooted searches, stopped and\n"
+                 "pruned searches, in slices of 1, 7 and 1000 steps and of 20 microseconds,\n"
+                 "and the same order as topoSort on DAGs\n";
+    std::size_t mismatches{0};
+    for (std::size_t round = 0; round < 10; ++round) {
+        auto r{randomGraph(rng, 2000, 8000, false)};
+        for (auto kind : {0, 1, 2, 3}) {
+            auto make = [&](std::vector<Event> *l) {
+                auto v{RecordingVisitor{l}};
+                if (kind == 2) {
+                    v.stopAt = 1000 + round;
+                } else if (kind == 3) {
+                    v.pruneAt = round;
+                }
+                return v;
+            };
+            expected.clear();
+            bool finished{kind == 1 ? graph::dfs(r, round, make(&expected))
+                                    : graph::dfs(r, make(&expected))};
+            for (auto budget : {graph::TraversalBudget{1}, graph::TraversalBudget{7},
+                                graph::TraversalBudget{1000},
+                                graph::TraversalBudget{.time = std::chrono::microseconds(20)}}) {
+                log.clear();
+                auto s{kind == 1 ? graph::ResumableDFS(r, round, make(&log))
+                                 : graph::ResumableDFS(r, make(&log))};
+                runInSlices(s, budget);
+                mismatches += log != expected || s.stopped() == finished;
+            }
+        }
+
+        auto dag{randomGraph(rng, 2000, 8000, true)};
+        auto order{std::vector<std::size_t>{}}, sliced{std::vector<std::size_t>{}};
+        graph::topoSort(dag, std::back_inserter(order));
+        auto topo{graph::resumableTopoSort(dag, std::back_inserter(sliced))};
+        runInSlices(topo, {100});
+        mismatches += sliced != order;
+    }
+    std::cout << "Result: " << mismatches << " mismatches\n";
+    ok = ok && mismatches == 0;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+/**
+ * test_static_graph.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of a StaticGraph, sorting a plugin dependency graph topologically and
+ * searching it depth-first at compile time, compared against the same
+ * computations on an AdjacencyList at run time.
+ */
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/concepts.hpp>
+#include <graph/depth_first_search.hpp>
+#include <graph/property_map.hpp>
+#include <graph/static_graph.hpp>
+#include <graph/tags.hpp>
+#include <graph/topological_sort.hpp>
+
+// Plugins, where an edge (u, v) means that u must be initialised before v.
+enum Plugin : std::size_t {
+    Log, Config, Storage, Network, Auth, Api, NumPlugins
+};
+
+constexpr const char *names[]{"Log", "Config", "Storage", "Network", "Auth", "Api"};
+
+constexpr auto plugins{graph::makeStaticGraph<NumPlugins>({
+    {Log, Config}, {Config, Storage}, {Config, Network}, {Storage, Auth},
+    {Network, Auth}, {Auth, Api}, {Network, Api}, {Log, Network}
+})};
+
+using Plugins = std::remove_const_t<decltype(plugins)>;
+static_assert(graph::VertexListGraph<Plugins>);
+static_assert(graph::EdgeListGraph<Plugins>);
+static_assert(graph::BidirectionalGraph<Plugins>);
+
+// topoSort writes the vertices in reverse topological order, so the
+// initialisation order is read backwards. The colours are kept in a
+// std::array, as the default workspace would allocate.
+constexpr auto initOrder{[] {
+    auto finished{std::array<std::size_t, NumPlugins>{}};
+    auto colours{std::array<graph::DFSColour, NumPlugins>{}};
+    graph::topoSort(plugins, finished.begin(), graph::makeIteratorVertexMap(colours.begin(), plugins));
+    auto order{std::array<std::size_t, NumPlugins>{}};
+    for (std::size_t i = 0; i < NumPlugins; ++i) {
+        order[i] = finished[NumPlugins - 1 - i];
+    }
+    return order;
+}()};
+
+static_assert(initOrder == std::array<std::size_t, NumPlugins>{
+    Log, Config, Network, Storage, Auth, Api
+});
+
+struct DiscoverVisitor : graph::DFSNullVisitor
+{
+    std::size_t *out;
+
+    template<typename G, typename V>
+    constexpr void discoverVertex(const V &v, const G &) { *out++ = v; }
+};
+
+// The plugins that Storage depends on, directly or not, in the order of a
+// search of the in-edges, found at compile time.
+struct Dependencies
+{
+    std::array<std::size_t, NumPlugins> plugins{};
+    std::size_t count = 0;
+};
+
+constexpr auto storageDependencies{[] {
+    auto deps{Dependencies{}};
+    auto visited{std::array<bool, NumPlugins>{}};
+    auto stack{std::array<std::size_t, NumPlugins>{Storage}};
+    std::size_t top{1};
+    visited[Storage] = true;
+    while (top > 0) {
+        auto v{stack[--top]};
+        for (const auto &e : inEdges(v, plugins)) {
+            if (!visited[source(e, plugins)]) {
+                visited[source(e, plugins)] = true;
+                deps.plugins[deps.count++] = source(e, plugins);
+                stack[top++] = source(e, plugins);
+            }
+        }
+    }
+    return deps;
+}()};
+
+static_assert(storageDependencies.count == 2);
+
+constexpr auto discoverOrder{[] {
+    auto order{std::array<std::size_t, NumPlugins>{}};
+    auto colours{std::array<graph::DFSColour, NumPlugins>{}};
+    graph::dfs(plugins, Network, DiscoverVisitor{{}, order.data()},
+               graph::makeIteratorVertexMap(colours.begin(), plugins));
+    return order;
+}()};
+
+// Network reaches Auth and Api only.
+static_assert(discoverOrder[0] == Network && discoverOrder[1] == Auth && discoverOrder[2] == Api);
+
+int main()
+{
+    using Graph = graph::AdjacencyList<graph::tags::Directed>;
+    auto g{Graph(NumPlugins)};
+    for (const auto &e : edges(plugins)) {
+        addEdge(source(e, plugins), target(e, plugins), g);
+    }
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of a StaticGraph of plugin dependencies, sorted at compile time\n\n";
+    std::cout << "Expected initialisation order, the same as topoSort on an AdjacencyList:\n";
+    std::cout << "Log Config Network Storage Auth Api \n";
+
+    auto finished{std::vector<std::size_t>{}};
+    graph::topoSort(g, std::back_inserter(finished));
+    std::cout << "\nResult:\n";
+    bool ok{true};
+    for (std::size_t i = 0; i < NumPlugins; ++i) {
+        std::cout << names[initOrder[i]] << ' ';
+        ok = ok && initOrder[i] == finished[NumPlugins - 1 - i];
+    }
+    std::cout << '\n';
+    std::cout << "\nExpected dependencies of Storage:\nConfig Log \n\nResult:\n";
+    for (std::size_t i = 0; i < storageDependencies.count; ++i) {
+        std::cout << names[storageDependencies.plugins[i]] << ' ';
+    }
+    std::cout << '\n';
+    ok = ok && storageDependencies.plugins[0] == Config && storageDependencies.plugins[1] == Log;
+
+    return ok ? 0 : 1;
+}
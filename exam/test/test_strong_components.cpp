@@ -0,0 +1,128 @@
+/**
+ * test_strong_components.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of strongly connected components and the condensation using the
+ * example in Figure 22.9 from CLRS p. 616, and of the parallel algorithm
+ * against the sequential one on a random graph.
+ */
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/concepts.hpp>
+#include <graph/property_map.hpp>
+#include <graph/strong_components.hpp>
+#include <graph/tags.hpp>
+#include <graph/topological_sort.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Bidirectional>;
+
+// Two numberings describe the same partition if they map one-to-one.
+bool samePartition(const std::vector<std::size_t> &a, const std::vector<std::size_t> &b)
+{
+    std::map<std::size_t, std::size_t> ab, ba;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (ab.emplace(a[i], b[i]).first->second != b[i]
+                || ba.emplace(b[i], a[i]).first->second != a[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    // a=0, b=1, c=2, d=3, e=4, f=5, g=6, h=7
+    const char *names{"abcdefgh"};
+    auto g{Graph(8)};
+    addEdge(0, 1, g);
+    addEdge(1, 2, g);
+    addEdge(1, 4, g);
+    addEdge(1, 5, g);
+    addEdge(2, 3, g);
+    addEdge(2, 6, g);
+    addEdge(3, 2, g);
+    addEdge(3, 7, g);
+    addEdge(4, 0, g);
+    addEdge(4, 5, g);
+    addEdge(5, 6, g);
+    addEdge(6, 5, g);
+    addEdge(6, 7, g);
+    addEdge(7, 7, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of strongly connected components\n";
+    std::cout << "using Figure 22.9 from CLRS p. 616 as an example\n\n";
+    std::cout << "Expected components (in reverse topological order):\n";
+    std::cout << "h | f g | c d | a b e\n";
+
+    auto comp{std::vector<std::size_t>(numVertices(g))};
+    auto numComp{graph::stronglyConnectedComponents(g, graph::makeIteratorVertexMap(comp.begin(), g))};
+    auto c{graph::condensation(g, graph::makeIteratorVertexMap(comp.begin(), g), numComp)};
+    std::cout << "\nResult:\n";
+    for (auto v : vertices(c)) {
+        std::cout << (v == 0 ? "" : " | ");
+        for (auto u : c[v]) {
+            std::cout << names[u] << (u == c[v].back() ? "" : " ");
+        }
+    }
+    std::cout << "\nCondensation: |V| = " << numVertices(c) << ", |E| = " << numEdges(c) << '\n';
+    bool ok{numComp == 4 && comp[7] == 0 && comp[5] == 1 && comp[6] == 1
+            && comp[2] == 2 && comp[3] == 2 && comp[0] == 3 && comp[1] == 3 && comp[4] == 3
+            && numEdges(c) == 5};
+    try {
+        graph::topoSortLevels(c, graph::execution::Parallel{1});
+    } catch (const graph::NotADagError &) {
+        ok = false;
+    }
+
+    auto pcomp{std::vector<std::size_t>(numVertices(g))};
+    auto pnumComp{graph::stronglyConnectedComponents(g, graph::makeIteratorVertexMap(pcomp.begin(), g),
+                                                     graph::execution::Parallel{4})};
+    std::cout << "Parallel algorithm finds the same components: "
+              << (pnumComp == numComp && samePartition(comp, pcomp) ? "yes" : "no") << '\n';
+    ok = ok && pnumComp == numComp && samePartition(comp, pcomp);
+
+    std::cout << "\nRandom graph with 20000 vertices and 50000 edges, 4 threads\n";
+    auto rg{Graph(20000)};
+    auto gen{std::mt19937(3)};
+    for (auto [u, v] : test::randomEdges(gen, 20000, 50000)) {
+        addEdge(u, v, rg);
+    }
+    auto rcomp{std::vector<std::size_t>(numVertices(rg))};
+    auto rpcomp{std::vector<std::size_t>(numVertices(rg))};
+    auto rnum{graph::stronglyConnectedComponents(rg, graph::makeIteratorVertexMap(rcomp.begin(), rg))};
+    auto rpnum{graph::stronglyConnectedComponents(rg, graph::makeIteratorVertexMap(rpcomp.begin(), rg),
+                                                  graph::execution::Parallel{4})};
+    auto rok{rnum == rpnum && samePartition(rcomp, rpcomp)};
+    std::cout << "Components: " << rnum << ", parallel and sequential agree: "
+              << (rok ? "yes" : "no") << '\n';
+
+    // repeated runs on one pool reuse its threads
+    auto pool{graph::ThreadPool(4)};
+    for (int run = 0; run < 10; ++run) {
+        auto runComp{std::vector<std::size_t>(numVertices(rg))};
+        auto runNum{graph::stronglyConnectedComponents(rg, graph::makeIteratorVertexMap(runComp.begin(), rg),
+                                                       pool)};
+        rok = rok && runNum == rnum && samePartition(rcomp, runComp);
+    }
+    std::cout << "10 runs on a shared pool agree: " << (rok ? "yes" : "no") << '\n';
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok ? 0 : 1;
+}
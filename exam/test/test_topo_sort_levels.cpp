@@ -0,0 +1,175 @@
+/**
+ * test_topo_sort_levels.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of the level-wise topological sorting using the example in
+ * Figure 22.7 from CLRS p. 613, and of the cycle detection, both on the
+ * example and on a random DAG large enough to peel its levels in parallel.
+ */
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/concepts.hpp>
+#include <graph/tags.hpp>
+#include <graph/topological_sort.hpp>
+#include <graph/traits.hpp>
+
+#include "random_graph.hpp"
+
+int main()
+{
+    using Graph = graph::AdjacencyList<graph::tags::Directed, std::string>;
+    auto g{Graph()};
+
+    addVertex(std::move(std::string{"shirt"}), g);       // 0
+    addVertex(std::move(std::string{"tie"}), g);         // 1
+    addVertex(std::move(std::string{"jacket"}), g);      // 2
+    addVertex(std::move(std::string{"belt"}), g);        // 3
+    addVertex(std::move(std::string{"watch"}), g);       // 4
+    addVertex(std::move(std::string{"pants"}), g);       // 5
+    addVertex(std::move(std::string{"undershorts"}), g); // 6
+    addVertex(std::move(std::string{"socks"}), g);       // 7
+    addVertex(std::move(std::string{"shoes"}), g);       // 8
+
+    addEdge(0, 1, g);
+    addEdge(0, 3, g);
+    addEdge(1, 2, g);
+    addEdge(3, 2, g);
+    addEdge(5, 3, g);
+    addEdge(5, 8, g);
+    addEdge(6, 5, g);
+    addEdge(6, 8, g);
+    addEdge(7, 8, g);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of level-wise topological sorting\n";
+    std::cout << "using Figure 22.7 from CLRS p. 613 as an example\n\n";
+
+    auto expected{std::vector<std::vector<std::size_t>>{{0, 4, 6, 7}, {1, 5}, {3, 8}, {2}}};
+    std::cout << "Expected levels (in any order within a level):\n";
+    std::cout << "0: shirt watch undershorts socks\n1: tie pants\n2: belt shoes\n3: jacket\n";
+
+    auto levels{graph::topoSortLevels(g, graph::execution::Parallel{4})};
+    std::cout << "\nResult:\n";
+    bool ok{levels.size() == expected.size()};
+    for (std::size_t i = 0; i < levels.size(); ++i) {
+        std::cout << i << ':';
+        for (auto v : levels[i]) {
+            std::cout << ' ' << g[v];
+        }
+        std::cout << '\n';
+        std::sort(levels[i].begin(), levels[i].end());
+        if (i < expected.size() && levels[i] != expected[i]) {
+            ok = false;
+        }
+    }
+
+    std::cout << "\nAdding the edge jacket -> pants, which closes the cycle\n";
+    std::cout << "pants -> belt -> jacket -> pants\n";
+    addEdge(2, 5, g);
+    bool thrown{false};
+    try {
+        graph::topoSortLevels(g, graph::execution::Parallel{4});
+    } catch (const graph::NotADagError &err) {
+        thrown = true;
+        std::cout << err.what() << "\nCycle:";
+        for (auto v : err.cycle()) {
+            std::cout << ' ' << g[v];
+        }
+        std::cout << '\n';
+        ok = ok && err.cycle().size() == 3;
+    }
+    ok = ok && thrown;
+
+    std::cout << "\nRandom DAG with 50000 vertices and 200000 edges, 4 threads\n";
+    std::cout << "Expected: every edge from a lower to a higher level, and the same levels\n"
+                 "as with 1 thread\n";
+    using Plain = graph::AdjacencyList<graph::tags::Directed>;
+    const std::size_t n{50000};
+    auto rg{Plain(n)};
+    auto gen{std::mt19937(42)};
+    for (auto [u, v] : test::randomDagEdges(gen, n, 200000)) {
+        addEdge(u, v, rg);
+    }
+    auto rlevels{graph::topoSortLevels(rg, graph::execution::Parallel{4})};
+    auto slevels{graph::topoSortLevels(rg, graph::execution::Parallel{1})};
+    auto levelOf{std::vector<std::size_t>(n, n)};
+    std::size_t widest{0};
+    for (std::size_t i = 0; i < rlevels.size(); ++i) {
+        widest = std::max(widest, rlevels[i].size());
+        for (auto v : rlevels[i]) {
+            levelOf[v] = i;
+        }
+    }
+    bool rok{std::find(levelOf.begin(), levelOf.end(), n) == levelOf.end()};
+    for (auto u : vertices(rg)) {
+        for (const auto &e : outEdges(u, rg)) {
+            rok = rok && levelOf[u] < levelOf[target(e, rg)];
+        }
+    }
+    rok = rok && rlevels.size() == slevels.size();
+    for (std::size_t i = 0; rok && i < rlevels.size(); ++i) {
+        std::sort(rlevels[i].begin(), rlevels[i].end());
+        std::sort(slevels[i].begin(), slevels[i].end());
+        rok = rlevels[i] == slevels[i];
+    }
+    std::cout << "\nResult: " << rlevels.size() << " levels, the widest of " << widest
+              << " vertices: " << (rok ? "ok" : "wrong") << '\n';
+
+    // an edge (u, v) and an out-edge (v, w) of its target give a cycle u v w
+    // when the edge (w, u), which goes against the order, is added
+    auto closeCycle = [&] {
+        for (auto u : vertices(rg)) {
+            for (const auto &e : outEdges(u, rg)) {
+                auto v{target(e, rg)};
+                if (outDegree(v, rg) > 0) {
+                    addEdge(target(*outEdges(v, rg).begin(), rg), u, rg);
+                    return;
+                }
+            }
+        }
+    };
+    closeCycle();
+    auto isEdge = [&](std::size_t u, std::size_t v) {
+        for (const auto &e : outEdges(u, rg)) {
+            if (target(e, rg) == v) {
+                return true;
+            }
+        }
+        return false;
+    };
+    std::cout << "\nAdding an edge against the order, which closes a cycle\n";
+    std::cout << "Expected: NotADagError holding a cycle of the graph\n";
+    bool rthrown{false};
+    try {
+        graph::topoSortLevels(rg, graph::execution::Parallel{4});
+    } catch (const graph::NotADagError &err) {
+        rthrown = true;
+        const auto &cycle{err.cycle()};
+        bool valid{cycle.size() >= 2};
+        for (std::size_t i = 0; valid && i < cycle.size(); ++i) {
+            valid = isEdge(cycle[i], cycle[(i + 1) % cycle.size()]);
+        }
+        std::cout << "\nResult: " << err.what() << ' '
+                  << (valid ? "Its edges are in the graph." : "It is not a cycle of the graph.")
+                  << '\n';
+        rok = rok && valid;
+    }
+    rok = rok && rthrown;
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok ? 0 : 1;
+}
@@ -0,0 +1,181 @@
+/**
+ * test_transitive_closure.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of the transitive closure and reduction on a small DAG, and on a
+ * random DAG compared against a search per source.
+ */
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/tags.hpp>
+#include <graph/transitive_closure.hpp>
+
+using Graph = graph::AdjacencyList<graph::tags::Bidirectional, std::string, int>;
+
+// Whether v is reachable from u without the edges from u to v.
+bool reachableWithout(const Graph &g, std::size_t u, std::size_t v)
+{
+    auto seen{std::vector<bool>(numVertices(g), false)};
+    auto stack{std::vector<std::size_t>{u}};
+    while (!stack.empty()) {
+        auto w{stack.back()};
+        stack.pop_back();
+        for (auto e : outEdges(w, g)) {
+            auto x{target(e, g)};
+            if (!(w == u && x == v) && !seen[x]) {
+                seen[x] = true;
+                stack.push_back(x);
+            }
+        }
+    }
+    return seen[v];
+}
+
+// The properties of the edges of g, sorted.
+std::vector<int> edgeProps(const Graph &g)
+{
+    auto props{std::vector<int>{}};
+    for (auto e : edges(g)) {
+        props.push_back(g[e]);
+    }
+    std::sort(props.begin(), props.end());
+    return props;
+}
+
+int main()
+{
+    // a -> b -> c -> d with the shortcuts a -> c, a -> d, b -> d, a duplicate
+    // b -> c, and e -> d
+    auto g{Graph{}};
+    for (auto name : {"a", "b", "c", "d", "e"}) {
+        addVertex(std::string(name), g);
+    }
+    int id{0};
+    for (auto [u, v] : std::vector<std::pair<std::size_t, std::size_t>>{
+             {0, 1}, {1, 2}, {0, 2}, {2, 3}, {0, 3}, {1, 3}, {1, 2}, {4, 3}}) {
+        addEdge(u, v, int{id++}, g);
+    }
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of the transitive closure and reduction\n\n";
+
+    std::cout << "Expected reduction edges (property: source -> target):\n";
+    std::cout << "0: a -> b  1: b -> c  3: c -> d  7: e -> d\n";
+    std::cout << "Expected reachable counts: a 3  b 2  c 1  d 0  e 1\n";
+
+    auto r{graph::transitiveReduction(g, graph::execution::Parallel{4})};
+    std::cout << "\nResult reduction edges:\n";
+    for (auto e : edges(r)) {
+        std::cout << r[e] << ": " << r[source(e, r)] << " -> " << r[target(e, r)] << "  ";
+    }
+    auto closure{graph::transitiveClosure(g, graph::execution::Parallel{4})};
+    std::cout << "\nResult reachable counts: ";
+    for (auto v : vertices(g)) {
+        std::cout << g[v] << ' ' << closure.numReachable(v) << "  ";
+    }
+    std::cout << '\n';
+    bool ok{edgeProps(r) == std::vector<int>{0, 1, 3, 7} && numVertices(r) == 5 && r[4] == "e"};
+    auto expectedCounts{std::vector<std::size_t>{3, 2, 1, 0, 1}};
+    for (auto v : vertices(g)) {
+        ok = ok && closure.numReachable(v) == expectedCounts[v];
+    }
+
+    // a graph whose only edge property is an inline weight keeps its weights
+    using WeightGraph = graph::AdjacencyList<graph::tags::Directed, graph::NoProp,
+                                             graph::NoProp, int>;
+    auto wg{WeightGraph(3)};
+    addEdge(0, 1, 5, wg);
+    addEdge(1, 2, 6, wg);
+    addEdge(0, 2, 7, wg);
+    auto wr{graph::transitiveReduction(wg, graph::execution::Parallel{2})};
+    std::cout << "Reduction of a graph with inline weights, expected 0 -> 1 5  1 -> 2 6\n";
+    for (auto e : edges(wr)) {
+        std::cout << source(e, wr) << " -> " << target(e, wr) << ' ' << inlineProp(e, wr) << "  ";
+        ok = ok && inlineProp(e, wr) == (source(e, wr) == 0 ? 5 : 6);
+    }
+    std::cout << '\n';
+    ok = ok && numEdges(wr) == 2;
+
+    std::cout << "\nRandom DAG with 1000 vertices and 6000 edges, 4 threads\n";
+    const std::size_t n{1000};
+    auto rg{Graph{}};
+    for (std::size_t v = 0; v < n; ++v) {
+        addVertex(std::to_string(v), rg);
+    }
+    auto rank{std::vector<std::size_t>(n)};
+    std::iota(rank.begin(), rank.end(), std::size_t{0});
+    auto gen{std::mt19937(42)};
+    std::shuffle(rank.begin(), rank.end(), gen);
+    // mostly short edges in the hidden order, so there are long paths
+    auto pick{std::uniform_int_distribution<std::size_t>(0, n - 1)};
+    auto step{std::geometric_distribution<std::size_t>(0.05)};
+    auto byRank{std::vector<std::size_t>(n)};
+    for (std::size_t v = 0; v < n; ++v) {
+        byRank[rank[v]] = v;
+    }
+    id = 0;
+    for (int i = 0; i < 6000; ++i) {
+        auto a{pick(gen)}, b{a + 1 + step(gen)};
+        if (b < n) {
+            addEdge(byRank[a], byRank[b], int{id++}, rg);
+        }
+    }
+
+    // of parallel edges, only the first is kept
+    auto expected{std::vector<int>{}};
+    auto added{std::vector<std::vector<bool>>(n, std::vector<bool>(n, false))};
+    for (auto e : edges(rg)) {
+        auto u{source(e, rg)}, v{target(e, rg)};
+        if (!added[u][v] && !reachableWithout(rg, u, v)) {
+            expected.push_back(rg[e]);
+        }
+        added[u][v] = true;
+    }
+    auto rr{graph::transitiveReduction(rg, graph::execution::Parallel{4})};
+    auto rrSmall{graph::transitiveReduction(rg, graph::execution::Parallel{4}, 4096)};
+    bool rok{edgeProps(rr) == expected && edgeProps(rrSmall) == expected};
+    for (auto v : vertices(rr)) {
+        rok = rok && rr[v] == rg[v];
+    }
+    std::cout << "Reduction (" << expected.size() << " of " << numEdges(rg)
+              << " edges) agrees with brute force, also in blocks: " << (rok ? "yes" : "no") << '\n';
+
+    auto rclosure{graph::transitiveClosure(rg, graph::execution::Parallel{4})};
+    bool cok{true};
+    for (std::size_t u = 0; u < n; ++u) {
+        auto seen{std::vector<bool>(n, false)};
+        auto stack{std::vector<std::size_t>{u}};
+        while (!stack.empty()) {
+            auto w{stack.back()};
+            stack.pop_back();
+            for (auto e : outEdges(w, rg)) {
+                if (!seen[target(e, rg)]) {
+                    seen[target(e, rg)] = true;
+                    stack.push_back(target(e, rg));
+                }
+            }
+        }
+        for (std::size_t v = 0; v < n; ++v) {
+            cok = cok && rclosure.reaches(u, v) == seen[v];
+        }
+    }
+    std::cout << "Closure agrees with a search per source: " << (cok ? "yes" : "no") << '\n';
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok && cok ? 0 : 1;
+}
@@ -0,0 +1,147 @@
+/**
+ * test_traversal_workspace.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of breadth-first search with a visitor on the example in Figure 22.3
+ * from CLRS p. 596, and of many small searches sharing one workspace.
+ */
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/breadth_first_search.hpp>
+#include <graph/depth_first_search.hpp>
+#include <graph/tags.hpp>
+#include <graph/traversal_workspace.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Directed>;
+
+// Records the distance of every discovered vertex.
+struct DistanceVisitor : graph::BFSNullVisitor
+{
+    template<typename G, typename E>
+    void treeEdge(const E &e, const G &g)
+    {
+        (*distance)[target(e, g)] = (*distance)[source(e, g)] + 1;
+    }
+
+    std::vector<std::size_t> *distance;
+};
+
+// Records the discovered vertices.
+struct RecordingBFSVisitor : graph::BFSNullVisitor
+{
+    template<typename G, typename V>
+    void discoverVertex(const V &v, const G &)
+    {
+        discovered->push_back(v);
+    }
+
+    std::vector<std::size_t> *discovered;
+};
+
+struct RecordingDFSVisitor : graph::DFSNullVisitor
+{
+    template<typename G, typename V>
+    void discoverVertex(const V &v, const G &)
+    {
+        discovered->push_back(v);
+    }
+
+    std::vector<std::size_t> *discovered;
+};
+
+std::vector<std::size_t> sorted(std::vector<std::size_t> vs)
+{
+    std::sort(vs.begin(), vs.end());
+    return vs;
+}
+
+int main()
+{
+    // The undirected graph of Figure 22.3 with both directions of every edge:
+    // r=0, s=1, t=2, u=3, v=4, w=5, x=6, y=7
+    auto g{Graph(8)};
+    auto addBoth = [&g](std::size_t u, std::size_t v) {
+        addEdge(u, v, g);
+        addEdge(v, u, g);
+    };
+    addBoth(0, 1);
+    addBoth(0, 4);
+    addBoth(1, 5);
+    addBoth(5, 2);
+    addBoth(5, 6);
+    addBoth(2, 6);
+    addBoth(2, 3);
+    addBoth(6, 3);
+    addBoth(6, 7);
+    addBoth(3, 7);
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of breadth-first search and of reusing a traversal workspace\n";
+    std::cout << "using Figure 22.3 from CLRS p. 596 as an example, source s = 1\n\n";
+
+    std::cout << "Expected distances:\n";
+    std::cout << "0: 1  1: 0  2: 2  3: 3  4: 2  5: 1  6: 2  7: 3\n";
+
+    auto workspace{graph::TraversalWorkspace<Graph>(g)};
+    auto distance{std::vector<std::size_t>(numVertices(g), 0)};
+    graph::bfs(g, 1, DistanceVisitor{{}, &distance}, workspace);
+    std::cout << "\nResult:\n";
+    for (auto v : vertices(g)) {
+        std::cout << v << ": " << distance[v] << "  ";
+    }
+    std::cout << '\n';
+    bool ok{distance == std::vector<std::size_t>{1, 0, 2, 3, 2, 1, 2, 3}};
+
+    // a second search with the same workspace must start from scratch
+    distance.assign(numVertices(g), 0);
+    graph::bfs(g, 1, DistanceVisitor{{}, &distance}, workspace);
+    ok = ok && distance == std::vector<std::size_t>{1, 0, 2, 3, 2, 1, 2, 3};
+
+    std::cout << "\nRandom graph with 1000000 vertices in components of 20, 1 workspace,\n"
+                 "20000 rooted searches, every 1000th compared against a fresh workspace\n";
+    const std::size_t n{1000000}, component{20};
+    auto rg{Graph(n)};
+    auto gen{std::mt19937(42)};
+    for (std::size_t c = 0; c < n; c += component) {
+        for (auto [u, v] : test::randomEdges(gen, component, 2 * component)) {
+            addEdge(c + u, c + v, rg);
+        }
+    }
+    auto shared{graph::TraversalWorkspace<Graph>(rg)};
+    auto pickSource{std::uniform_int_distribution<std::size_t>(0, n - 1)};
+    bool rok{true};
+    for (int i = 0; i < 20000; ++i) {
+        auto s{pickSource(gen)};
+        auto bfsOrder{std::vector<std::size_t>{}}, dfsOrder{std::vector<std::size_t>{}};
+        graph::bfs(rg, s, RecordingBFSVisitor{{}, &bfsOrder}, shared);
+        graph::dfs(rg, s, RecordingDFSVisitor{{}, &dfsOrder}, shared);
+        if (i % 1000 == 0) {
+            auto fresh{std::vector<std::size_t>{}};
+            graph::bfs(rg, s, RecordingBFSVisitor{{}, &fresh});
+            rok = rok && fresh == bfsOrder;
+        }
+        rok = rok && sorted(bfsOrder) == sorted(dfsOrder) && dfsOrder.front() == s;
+        for (auto v : bfsOrder) {
+            rok = rok && v / component == s / component;
+        }
+    }
+    std::cout << "Searches agree and stay within their component: " << (rok ? "yes" : "no") << '\n';
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok ? 0 : 1;
+}
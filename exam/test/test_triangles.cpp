@@ -0,0 +1,107 @@
+/**
+ * test_triangles.cpp
+ *
+ * DM852 Introduction to Generic Programming
+ *
+ * Final Project - Spring 2022
+ *
+ * Dennis Andersen - deand17
+ * 2022-06-15
+ *
+ * Test of triangle counting and local clustering coefficients on a small
+ * example, and on a random graph compared against a brute force count.
+ */
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <graph/adjacency_list.hpp>
+#include <graph/property_map.hpp>
+#include <graph/static_graph.hpp>
+#include <graph/tags.hpp>
+#include <graph/triangles.hpp>
+
+#include "random_graph.hpp"
+
+using Graph = graph::AdjacencyList<graph::tags::Directed>;
+
+int main()
+{
+    // A complete graph on 0..3, a triangle 3-4-5 and a pendant vertex 6, with
+    // a reversed duplicate, a parallel edge, a self-loop and mixed edge
+    // directions. AdjacencyList allows neither of the last, so it is a
+    // StaticGraph.
+    const auto g{graph::makeStaticGraph<7>({
+        {0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}, {1, 0}, {2, 2},
+        {3, 4}, {5, 4}, {3, 5}, {3, 5}, {6, 5}
+    })};
+
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+    std::cout << "DM852 Introduction to Generic Programming\n";
+    std::cout << "Final Project - Spring 2022 - Dennis Andersen - deand17\n\n";
+    std::cout << "Test of triangle counting and local clustering coefficients\n\n";
+
+    std::cout << "Expected triangles: 5\n";
+    std::cout << "Expected coefficients:\n";
+    std::cout << "0: 1  1: 1  2: 1  3: 0.4  4: 1  5: 0.333333  6: 0\n";
+
+    auto triangles{graph::countTriangles(g, graph::execution::Parallel{4})};
+    auto coefficients{std::vector<double>(numVertices(g))};
+    graph::localClusteringCoefficient(g, graph::makeIteratorVertexMap(coefficients.begin(), g),
+                                      graph::execution::Parallel{4});
+    std::cout << "\nResult triangles: " << triangles << '\n';
+    std::cout << "Result coefficients:\n";
+    for (auto v : vertices(g)) {
+        std::cout << v << ": " << coefficients[v] << "  ";
+    }
+    std::cout << '\n';
+
+    auto expected{std::vector<double>{1, 1, 1, 0.4, 1, 1.0 / 3, 0}};
+    bool ok{triangles == 5};
+    for (std::size_t v = 0; v < expected.size(); ++v) {
+        ok = ok && std::abs(coefficients[v] - expected[v]) < 1e-12;
+    }
+
+    std::cout << "\nRandom graph with 400 vertices and 20000 edges, 4 threads\n";
+    const std::size_t n{400};
+    auto rg{Graph(n)};
+    auto adjacent{std::vector<std::vector<bool>>(n, std::vector<bool>(n))};
+    auto gen{std::mt19937(42)};
+    for (auto [u, v] : test::randomEdges(gen, n, 20000)) {
+        addEdge(u, v, rg);
+        adjacent[u][v] = adjacent[v][u] = true;
+    }
+    std::uint64_t bruteForce{0};
+    auto atVertex{std::vector<std::size_t>(n)};
+    for (std::size_t u = 0; u < n; ++u) {
+        for (std::size_t v = u + 1; v < n; ++v) {
+            for (std::size_t w = v + 1; adjacent[u][v] && w < n; ++w) {
+                if (adjacent[u][w] && adjacent[v][w]) {
+                    ++bruteForce;
+                    ++atVertex[u];
+                    ++atVertex[v];
+                    ++atVertex[w];
+                }
+            }
+        }
+    }
+    auto rcoefficients{std::vector<double>(n)};
+    graph::localClusteringCoefficient(rg, graph::makeIteratorVertexMap(rcoefficients.begin(), rg),
+                                      graph::execution::Parallel{4});
+    bool rok{graph::countTriangles(rg, graph::execution::Parallel{4}) == bruteForce};
+    for (std::size_t u = 0; u < n; ++u) {
+        double d{0};
+        for (std::size_t v = 0; v < n; ++v) {
+            d += adjacent[u][v];
+        }
+        auto c{d < 2 ? 0.0 : 2.0 * atVertex[u] / (d * (d - 1))};
+        rok = rok && std::abs(rcoefficients[u] - c) < 1e-12;
+    }
+    std::cout << "Triangles (" << bruteForce << ") and coefficients agree with brute force: "
+              << (rok ? "yes" : "no") << '\n';
+    std::cout << std::setfill('=') << std::setw(80) << "" << '\n';
+
+    return ok && rok ? 0 : 1;
+}